@@ -64,6 +64,12 @@ int main(int argc, char *argv[])
 	// Register ProxyChannelModel Type in QML.
 	qmlRegisterType<rss::ProxyChannelModel>( "ProxyChannelModel", 1, 0, "ProxyChannelModel" );
 
+	// Register ParseStats, passed by ChannelModel::parseFinished.
+	qRegisterMetaType<rss::ParseStats>( "rss::ParseStats" );
+
+	// Register PoolStats, returned by ChannelModel::getTextPoolStats, etc.
+	qRegisterMetaType<rss::PoolStats>( "rss::PoolStats" );
+
     // Create QML Application Enigne
     QQmlApplicationEngine engine;
 
@@ -0,0 +1,719 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include rss::SAXRSSHandler
+#ifndef QRSS_READER_SAX_RSS_HANDLER_HPP
+#include "../utils/SAXRSSHandler.hpp"
+#endif // !QRSS_READER_SAX_RSS_HANDLER_HPP
+
+// Include rss::FastRSSScanner
+#ifndef QRSS_READER_FAST_RSS_SCANNER_HPP
+#include "../utils/FastRSSScanner.hpp"
+#endif // !QRSS_READER_FAST_RSS_SCANNER_HPP
+
+// Include rss::StreamRSSReader
+#ifndef QRSS_READER_STREAM_RSS_READER_HPP
+#include "../utils/StreamRSSReader.hpp"
+#endif // !QRSS_READER_STREAM_RSS_READER_HPP
+
+// Include rss::Channel
+#ifndef QRSS_READER_CHANNEL_HPP
+#include "../rss/Channel.hpp"
+#endif // !QRSS_READER_CHANNEL_HPP
+
+// Include rss::Text, rss::Link, rss::Date (pooled Elements)
+#ifndef QRSS_READER_TEXT_HPP
+#include "../rss/Text.hpp"
+#endif // !QRSS_READER_TEXT_HPP
+#ifndef QRSS_READER_LINK_HPP
+#include "../rss/Link.hpp"
+#endif // !QRSS_READER_LINK_HPP
+#ifndef QRSS_READER_DATE_HPP
+#include "../rss/Date.hpp"
+#endif // !QRSS_READER_DATE_HPP
+
+// Include rss::ElementArena
+#ifndef QRSS_READER_ELEMENT_ARENA_HPP
+#include "../utils/ElementArena.hpp"
+#endif // !QRSS_READER_ELEMENT_ARENA_HPP
+
+// Include rss::ElementPool
+#ifndef QRSS_READER_ELEMENT_POOL_HPP
+#include "../utils/ElementPool.hpp"
+#endif // !QRSS_READER_ELEMENT_POOL_HPP
+
+// Include QCoreApplication
+#ifndef QCOREAPPLICATION_H
+#include <QCoreApplication>
+#endif // !QCOREAPPLICATION_H
+
+// Include QFile
+#ifndef QFILE_H
+#include <QFile>
+#endif // !QFILE_H
+
+// Include QFileInfo
+#ifndef QFILEINFO_H
+#include <QFileInfo>
+#endif // !QFILEINFO_H
+
+// Include QDir
+#ifndef QDIR_H
+#include <QDir>
+#endif // !QDIR_H
+
+// Include QBuffer
+#ifndef QBUFFER_H
+#include <QBuffer>
+#endif // !QBUFFER_H
+
+// Include QElapsedTimer
+#ifndef QELAPSEDTIMER_H
+#include <QElapsedTimer>
+#endif // !QELAPSEDTIMER_H
+
+// Include C++ printf
+#include <cstdio>
+
+// Include glibc heap statistics (mallinfo2).
+#if defined( __GLIBC__ ) && ( __GLIBC__ > 2 || ( __GLIBC__ == 2 && __GLIBC_MINOR__ >= 33 ) )
+#define QRSS_READER_BENCHMARK_MALLINFO
+#include <malloc.h>
+#endif // __GLIBC__
+
+// Include POSIX resource usage (peak RSS).
+#if defined( Q_OS_UNIX )
+#include <sys/resource.h>
+#endif // Q_OS_UNIX
+
+// ===========================================================
+// ParseBenchmark
+// ===========================================================
+
+/**
+  * ParseBenchmark - measures parsing throughput of RSS engines (SAX, fast Scanner, pull-parser).
+  * <br/>
+  *
+  * @brief<br/>
+  * Feeds read to memory before timing, so only parsing measured.
+  * Allocations & fragmentation of Channel Arena compared with heap (pools) path.
+  * With --input, Files parsed from disk (SAX), mapped or through QFile device,
+  * wall time & peak RSS printed. Peak RSS is per process, so one mode per run.
+  * Usage: QRssReaderBenchmark [--repeat N] [--input mapped|device] <feed files or directories>
+  * <br/>
+  *
+  * <br/>
+  * @version 0.1
+  * @since 17.10.2026
+  * @authors Denis Z. (code4un@yandex.ru)
+**/
+
+namespace
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// CONSTANTS
+	// ===========================================================
+
+	/** Default number of runs over Feeds corpus. **/
+	constexpr int DEFAULT_REPEAT = 5;
+
+	/** Bytes in MB. **/
+	constexpr double MEGABYTE = 1024.0 * 1024.0;
+
+	// ===========================================================
+	// TYPES
+	// ===========================================================
+
+	/** Parsing Engines. **/
+	enum Engine
+	{
+
+		/** QXmlSimpleReader & SAXRSSHandler. **/
+		SAX_ENGINE = 0,
+
+		/** FastRSSScanner. **/
+		FAST_ENGINE = 1,
+
+		/** QXmlStreamReader & StreamRSSReader. **/
+		STREAM_ENGINE = 2,
+
+		/** Number of Engines. **/
+		ENGINES_COUNT = 3
+
+	}; /// Engine
+
+	/** Engines names. **/
+	const char *const ENGINE_NAMES[ENGINES_COUNT] = { "SAX", "Fast", "Stream" };
+
+	/** Feed, read to memory. **/
+	struct Feed
+	{
+
+		/** File-Path. **/
+		QString mPath;
+
+		/** File bytes. **/
+		QByteArray mData;
+
+	}; /// Feed
+
+	/** Engine results over corpus. **/
+	struct Result
+	{
+
+		/** Parsed bytes. **/
+		qint64 mBytes;
+
+		/** Parsing time. **/
+		qint64 mNanoseconds;
+
+		/** Feeds, Engine failed (Fast Scanner gave up). **/
+		int mFailed;
+
+	}; /// Result
+
+	/** Allocations of one pass over corpus, Channels kept until released. **/
+	struct Memory
+	{
+
+		/** Elements created (heap allocations of code without Arena & pools). **/
+		qint64 mElements;
+
+		/** Heap allocations: Arena blocks, or Elements not taken from pools. **/
+		qint64 mHeapAllocations;
+
+		/** Arena block bytes. **/
+		qint64 mArenaReserved;
+
+		/** Arena bytes used by Elements. **/
+		qint64 mArenaUsed;
+
+		/** Heap bytes in use with parsed Channels, -1 if unknown. **/
+		qint64 mHeapInUse;
+
+		/** Heap bytes free but kept by allocator after Channels released, -1 if unknown. **/
+		qint64 mHeapRetained;
+
+		/** Channels release time. **/
+		qint64 mReleaseNanoseconds;
+
+	}; /// Memory
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Returns heap bytes in use, -1 if unknown.
+	**/
+	qint64 heapInUse( ) noexcept
+	{
+#if defined( QRSS_READER_BENCHMARK_MALLINFO )
+		return( static_cast<qint64>( mallinfo2( ).uordblks ) );
+#else // !QRSS_READER_BENCHMARK_MALLINFO
+		return( -1 );
+#endif // QRSS_READER_BENCHMARK_MALLINFO
+	}
+
+	/**
+	  * Returns heap bytes free, but kept by allocator, -1 if unknown.
+	**/
+	qint64 heapRetained( ) noexcept
+	{
+#if defined( QRSS_READER_BENCHMARK_MALLINFO )
+		return( static_cast<qint64>( mallinfo2( ).fordblks ) );
+#else // !QRSS_READER_BENCHMARK_MALLINFO
+		return( -1 );
+#endif // QRSS_READER_BENCHMARK_MALLINFO
+	}
+
+	/**
+	  * Returns number of pooled Elements, taken from pools.
+	**/
+	qint64 countPoolHits( ) noexcept
+	{ return( rss::ElementPool<rss::Text>::getStats( ).mHits + rss::ElementPool<rss::Link>::getStats( ).mHits + rss::ElementPool<rss::Date>::getStats( ).mHits ); }
+
+	/**
+	  * Adds File, or all Files of directory, to paths.
+	  *
+	  * @param pPath - File or directory path.
+	  * @param pPaths - Files paths.
+	**/
+	void addPaths( const QString & pPath, QStringList & pPaths ) noexcept
+	{
+
+		// Directory
+		const QFileInfo info_( pPath );
+		if ( info_.isDir( ) )
+		{
+			const QFileInfoList entries_( QDir( pPath ).entryInfoList( QDir::Files | QDir::Readable, QDir::Name ) );
+			for( const QFileInfo & entry_ : entries_ )
+				pPaths.push_back( entry_.absoluteFilePath( ) );
+			return;
+		}
+
+		// File
+		pPaths.push_back( pPath );
+
+	}
+
+	/**
+	  * Reads Files to corpus.
+	  *
+	  * @param pPaths - Files paths.
+	  * @param pFeeds - corpus.
+	**/
+	void readFeeds( const QStringList & pPaths, QVector<Feed> & pFeeds ) noexcept
+	{
+		for( const QString & path_ : pPaths )
+		{
+			QFile file_( path_ );
+			if ( file_.open( QIODevice::ReadOnly ) )
+				pFeeds.push_back( Feed{ path_, file_.readAll( ) } );
+			else
+				std::fprintf( stderr, "Can't read %s\n", qPrintable( path_ ) );
+		}
+	}
+
+	/**
+	  * Returns peak RSS of process (KB), -1 if unknown.
+	**/
+	qint64 peakRSS( ) noexcept
+	{
+#if defined( Q_OS_UNIX )
+		rusage usage_;
+		if ( getrusage( RUSAGE_SELF, &usage_ ) == 0 )
+#if defined( Q_OS_DARWIN )
+			return( static_cast<qint64>( usage_.ru_maxrss ) / 1024 ); // bytes
+#else // !Q_OS_DARWIN
+			return( static_cast<qint64>( usage_.ru_maxrss ) ); // KB
+#endif // Q_OS_DARWIN
+#endif // Q_OS_UNIX
+		return( -1 );
+	}
+
+	/**
+	  * Parses Files from disk with SAX Engine: mapped pages through QBuffer (ChannelModel::parseFile),
+	  * or QFile device (code without mapping). Prints wall time & peak RSS.
+	  *
+	  * @param pPaths - Files paths.
+	  * @param pMapped - 'true' to map Files.
+	  * @param pRepeat - number of runs.
+	**/
+	void runInput( const QStringList & pPaths, const bool pMapped, const int pRepeat ) noexcept
+	{
+
+		// Bytes & failed Files.
+		qint64 bytes_( 0 );
+		int failed_( 0 );
+
+		// Wall time.
+		QElapsedTimer timer_;
+		timer_.start( );
+
+		// Runs
+		for( int run_ = 0; run_ < pRepeat; run_++ )
+		{
+			for( const QString & path_ : pPaths )
+			{
+
+				// Open File.
+				QFile file_( path_ );
+				if ( !file_.open( QIODevice::ReadOnly ) )
+				{
+					failed_ += run_ == 0 ? 1 : 0;
+					continue;
+				}
+				const qint64 size_( file_.size( ) );
+				bytes_ += size_;
+
+				// Map File.
+				uchar *const mappedFile_( pMapped && size_ > 0 ? file_.map( 0, size_ ) : nullptr );
+				if ( pMapped && mappedFile_ == nullptr )
+				{
+					failed_ += run_ == 0 ? 1 : 0;
+					continue;
+				}
+
+				// Device over mapped pages, not copied.
+				QByteArray mappedData_;
+				QBuffer mappedBuffer_;
+				if ( mappedFile_ != nullptr )
+				{
+					mappedData_ = QByteArray::fromRawData( reinterpret_cast<const char*>( mappedFile_ ), static_cast<int>( size_ ) );
+					mappedBuffer_.setBuffer( &mappedData_ );
+					mappedBuffer_.open( QIODevice::ReadOnly );
+				}
+
+				// Parse
+				rss::SAXRSSHandler handler_( nullptr, nullptr );
+				QXmlInputSource inputSource( mappedFile_ != nullptr ? static_cast<QIODevice*>( &mappedBuffer_ ) : &file_ );
+				QXmlSimpleReader xmlReader;
+				xmlReader.setContentHandler( &handler_ );
+				xmlReader.setErrorHandler( &handler_ );
+				if ( !xmlReader.parse( &inputSource ) && run_ == 0 )
+					failed_++;
+
+				// Delete Channel & unmap File.
+				delete handler_.getChannel( );
+				if ( mappedFile_ != nullptr )
+				{
+					mappedBuffer_.close( );
+					file_.unmap( mappedFile_ );
+				}
+
+			}
+		} /// Runs
+
+		// Print
+		const qint64 nanoseconds_( timer_.nsecsElapsed( ) );
+		std::printf( "Input=%s files=%d %.2f MB wall=%.2f ms %.2f MB/s peak-RSS=%lld KB failed=%d\n", pMapped ? "mapped" : "device", pPaths.size( ), bytes_ / MEGABYTE,
+			nanoseconds_ / 1e6, nanoseconds_ > 0 ? ( bytes_ / MEGABYTE ) / ( nanoseconds_ / 1e9 ) : 0.0, peakRSS( ), failed_ );
+
+	}
+
+	/**
+	  * Parses Feed bytes with SAX Engine.
+	  *
+	  * @param pData - Feed bytes.
+	  * @param pHandler - RSS Handler.
+	  * @return - 'true' if parsed.
+	**/
+	bool parseSAX( const QByteArray & pData, rss::SAXRSSHandler & pHandler ) noexcept
+	{
+
+		// Device over Feed bytes.
+		QBuffer buffer_;
+		buffer_.setData( pData );
+		buffer_.open( QIODevice::ReadOnly );
+
+		// Create Xml-InputSource & default Xml-Reader.
+		QXmlInputSource inputSource( &buffer_ );
+		QXmlSimpleReader xmlReader;
+		xmlReader.setContentHandler( &pHandler );
+		xmlReader.setErrorHandler( &pHandler );
+
+		// Parse
+		return( xmlReader.parse( &inputSource ) );
+
+	}
+
+	/**
+	  * Parses Feed bytes with fast Scanner.
+	  *
+	  * @param pData - Feed bytes.
+	  * @param pHandler - RSS Handler.
+	  * @return - 'true' if parsed, 'false' if Scanner gave up.
+	**/
+	bool parseFast( const QByteArray & pData, rss::SAXRSSHandler & pHandler ) noexcept
+	{
+
+		// Create Scanner.
+		rss::FastRSSScanner scanner_( &pHandler );
+
+		// Scan
+		return( scanner_.parse( pData.constData( ), pData.size( ) ) );
+
+	}
+
+	/**
+	  * Parses Feed bytes with pull-parser (stream) Engine.
+	  *
+	  * @param pData - Feed bytes.
+	  * @param pHandler - RSS Handler.
+	  * @return - 'true' if parsed.
+	**/
+	bool parseStream( const QByteArray & pData, rss::SAXRSSHandler & pHandler ) noexcept
+	{
+
+		// Device over Feed bytes.
+		QBuffer buffer_;
+		buffer_.setData( pData );
+		buffer_.open( QIODevice::ReadOnly );
+
+		// Create Reader.
+		rss::StreamRSSReader reader_( &pHandler );
+
+		// Parse
+		return( reader_.parse( &buffer_ ) );
+
+	}
+
+	/**
+	  * Parses Feed bytes with Engine.
+	  *
+	  * @param pData - Feed bytes.
+	  * @param pHandler - RSS Handler.
+	  * @param pEngine - Engine.
+	  * @return - 'true' if parsed.
+	**/
+	bool parse( const QByteArray & pData, rss::SAXRSSHandler & pHandler, const int pEngine ) noexcept
+	{
+
+		// Engine
+		switch( pEngine )
+		{
+
+		// Fast Scanner.
+		case FAST_ENGINE:
+			return( parseFast( pData, pHandler ) );
+
+		// Pull-Parser.
+		case STREAM_ENGINE:
+			return( parseStream( pData, pHandler ) );
+
+		// SAX
+		default:
+			return( parseSAX( pData, pHandler ) );
+
+		} /// Engine
+
+	}
+
+	/**
+	  * Parses corpus with Engine.
+	  *
+	  * @param pFeeds - corpus.
+	  * @param pEngine - Engine.
+	  * @param pRepeat - number of runs.
+	  * @return - Result.
+	**/
+	Result runEngine( const QVector<Feed> & pFeeds, const int pEngine, const int pRepeat ) noexcept
+	{
+
+		// Result
+		Result result_{ 0, 0, 0 };
+
+		// Timer
+		QElapsedTimer timer_;
+
+		// Runs
+		for( int run_ = 0; run_ < pRepeat; run_++ )
+		{
+			for( const Feed & feed_ : pFeeds )
+			{
+
+				// Staging Handler, without Model.
+				rss::SAXRSSHandler handler_( nullptr, nullptr );
+
+				// Parse
+				timer_.start( );
+				const bool parsed_( parse( feed_.mData, handler_, pEngine ) );
+				result_.mNanoseconds += timer_.nsecsElapsed( );
+				result_.mBytes += feed_.mData.size( );
+
+				// Count failed Feeds, once per corpus.
+				if ( !parsed_ && run_ == 0 )
+					result_.mFailed++;
+
+				// Delete Channel.
+				delete handler_.getChannel( );
+
+			}
+		} /// Runs
+
+		// Return Result.
+		return( result_ );
+
+	}
+
+	/**
+	  * Parses corpus once with SAX Engine, all Channels kept, then released.
+	  *
+	  * @param pFeeds - corpus.
+	  * @param pUseArena - 'true' to allocate Elements from Channel Arena, 'false' for heap & pools.
+	  * @return - Memory.
+	**/
+	Memory runMemory( const QVector<Feed> & pFeeds, const bool pUseArena ) noexcept
+	{
+
+		// Counters before parsing.
+		const qint64 elements_( rss::Element::countAllocations( ) );
+		const qint64 blocks_( rss::ElementArena::countBlocks( ) );
+		const qint64 reserved_( rss::ElementArena::countReservedBytes( ) );
+		const qint64 used_( rss::ElementArena::countUsedBytes( ) );
+		const qint64 poolHits_( countPoolHits( ) );
+		const qint64 heapInUse_( heapInUse( ) );
+
+		// Parse, keep Channels.
+		QVector<rss::Channel*> channels_;
+		channels_.reserve( pFeeds.size( ) );
+		for( const Feed & feed_ : pFeeds )
+		{
+			rss::SAXRSSHandler handler_( nullptr, nullptr );
+			handler_.setUseArena( pUseArena );
+			parseSAX( feed_.mData, handler_ );
+			rss::Channel *const channel_( handler_.getChannel( ) );
+			if ( channel_ != nullptr )
+				channels_.push_back( channel_ );
+		}
+
+		// Result
+		Memory result_;
+		result_.mElements = rss::Element::countAllocations( ) - elements_;
+		result_.mArenaReserved = rss::ElementArena::countReservedBytes( ) - reserved_;
+		result_.mArenaUsed = rss::ElementArena::countUsedBytes( ) - used_;
+		result_.mHeapAllocations = pUseArena ? rss::ElementArena::countBlocks( ) - blocks_ : result_.mElements - ( countPoolHits( ) - poolHits_ );
+		result_.mHeapInUse = heapInUse_ < 0 ? -1 : heapInUse( ) - heapInUse_;
+
+		// Release Channels.
+		QElapsedTimer timer_;
+		timer_.start( );
+		for( rss::Channel *const channel_ : channels_ )
+			delete channel_;
+		result_.mReleaseNanoseconds = timer_.nsecsElapsed( );
+		result_.mHeapRetained = heapRetained( );
+
+		// Return Result.
+		return( result_ );
+
+	}
+
+	/**
+	  * Prints Memory Result.
+	  *
+	  * @param pName - allocation mode name.
+	  * @param pMemory - Memory.
+	**/
+	void printMemory( const char *const pName, const Memory & pMemory ) noexcept
+	{
+
+		// Arena bytes, not used by Elements (blocks tails).
+		const double waste_( pMemory.mArenaReserved > 0 ? 100.0 * ( pMemory.mArenaReserved - pMemory.mArenaUsed ) / pMemory.mArenaReserved : 0.0 );
+
+		// Print
+		std::printf( "%-6s elements=%lld heap-allocations=%lld arena=%.2f/%.2f MB (%.1f%% unused) heap-in-use=%.2f MB retained-after-release=%.2f MB release=%.2f ms\n",
+			pName, pMemory.mElements, pMemory.mHeapAllocations, pMemory.mArenaUsed / MEGABYTE, pMemory.mArenaReserved / MEGABYTE, waste_,
+			pMemory.mHeapInUse / MEGABYTE, pMemory.mHeapRetained / MEGABYTE, pMemory.mReleaseNanoseconds / 1e6 );
+
+	}
+
+	/**
+	  * Returns throughput (MB/s).
+	  *
+	  * @param pResult - Result.
+	**/
+	double throughput( const Result & pResult ) noexcept
+	{ return( pResult.mNanoseconds > 0 ? ( pResult.mBytes / MEGABYTE ) / ( pResult.mNanoseconds / 1e9 ) : 0.0 ); }
+
+	// -----------------------------------------------------------
+
+} /// namespace
+
+// ===========================================================
+// MAIN
+// ===========================================================
+
+/**
+  * Runs benchmark.
+  *
+  * @param argc - number of arguments.
+  * @param argv - arguments.
+  * @return - 0 if benchmark done, 1 if no Feeds.
+**/
+int main( int argc, char * argv[] )
+{
+
+	// Application
+	QCoreApplication app_( argc, argv );
+
+	// Arguments
+	QStringList args_( QCoreApplication::arguments( ) );
+	args_.removeFirst( );
+
+	// Number of runs.
+	int repeat_( DEFAULT_REPEAT );
+
+	// Input mode, empty to parse corpus from memory.
+	QString input_;
+
+	// Files
+	QStringList paths_;
+	for( int i = 0; i < args_.size( ); i++ )
+	{
+		if ( args_.at( i ) == "--repeat" && i + 1 < args_.size( ) )
+			repeat_ = qMax( args_.at( ++i ).toInt( ), 1 );
+		else if ( args_.at( i ) == "--input" && i + 1 < args_.size( ) )
+			input_ = args_.at( ++i );
+		else
+			addPaths( args_.at( i ), paths_ );
+	}
+
+	// Usage
+	if ( paths_.isEmpty( ) || ( !input_.isEmpty( ) && input_ != "mapped" && input_ != "device" ) )
+	{
+		std::fprintf( stderr, "Usage: QRssReaderBenchmark [--repeat N] [--input mapped|device] <feed files or directories>\n" );
+		return( 1 );
+	}
+
+	// Parse from disk, Files not read to memory before (peak RSS).
+	if ( !input_.isEmpty( ) )
+	{
+		runInput( paths_, input_ == "mapped", repeat_ );
+		return( 0 );
+	}
+
+	// Corpus
+	QVector<Feed> feeds_;
+	readFeeds( paths_, feeds_ );
+	if ( feeds_.isEmpty( ) )
+		return( 1 );
+
+	// Corpus size.
+	qint64 corpusBytes_( 0 );
+	for( const Feed & feed_ : feeds_ )
+		corpusBytes_ += feed_.mData.size( );
+	std::printf( "Corpus: %d feeds, %.2f MB, %d runs\n", feeds_.size( ), corpusBytes_ / MEGABYTE, repeat_ );
+
+	// Engines
+	Result results_[ENGINES_COUNT];
+	for( int engine_ = 0; engine_ < ENGINES_COUNT; engine_++ )
+	{
+		results_[engine_] = runEngine( feeds_, engine_, repeat_ );
+		std::printf( "%-6s %10.2f MB/s  %10.2f ms  failed=%d\n", ENGINE_NAMES[engine_], throughput( results_[engine_] ), results_[engine_].mNanoseconds / 1e6, results_[engine_].mFailed );
+	}
+
+	// Fast Scanner (target 5x) & pull-parser speedup. Feeds, Scanner gave up, parsed by SAX in application.
+	const double saxThroughput_( throughput( results_[SAX_ENGINE] ) );
+	if ( saxThroughput_ > 0.0 )
+	{
+		std::printf( "Fast/SAX speedup: %.2fx (target 5x)\n", throughput( results_[FAST_ENGINE] ) / saxThroughput_ );
+		std::printf( "Stream/SAX speedup: %.2fx\n", throughput( results_[STREAM_ENGINE] ) / saxThroughput_ );
+	}
+
+	// Allocations & fragmentation: Channel Arena, heap (Elements pools). Heap bytes -1 if unknown (not glibc).
+	printMemory( "Arena", runMemory( feeds_, true ) );
+	printMemory( "Heap", runMemory( feeds_, false ) );
+
+	// Return 0
+	return( 0 );
+
+}
+
+// -----------------------------------------------------------
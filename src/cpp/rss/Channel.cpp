@@ -34,6 +34,19 @@
 #include "Text.hpp"
 #endif // !QRSS_READER_TEXT_HPP
 
+// Include rss::Date
+#ifndef QRSS_READER_DATE_HPP
+#include "Date.hpp"
+#endif // !QRSS_READER_DATE_HPP
+
+// Include rss::RSSTags
+#ifndef QRSS_READER_RSS_TAGS_HPP
+#include "../utils/RSSTags.hpp"
+#endif // !QRSS_READER_RSS_TAGS_HPP
+
+// Include C++ algorithms (stable_sort).
+#include <algorithm>
+
 #if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
 
 // Include QDebug
@@ -65,10 +78,21 @@ namespace rss
 	Channel::Channel( const QString & rssVersion ) noexcept
 		: Element( ElementType::CHANNEL, nullptr ),
 		  mRSSVersion( rssVersion ),
-		  mElements( ),
+		  mHeader( nullptr ),
+		  mRetiredHeaders( ),
+		  mRetiredElements( ),
+		  mPublished( false ),
 		  mElementsMutex( ),
 		  mItems( ),
-		  mItemsMutex( )
+		  mItemRecords( ),
+		  mItemGuids( ),
+		  mItemDates( ),
+		  mItemTitles( ),
+		  mItemFlags( ),
+		  mRetiredItems( ),
+		  mItemsChanged( false ),
+		  mItemsMutex( ),
+		  mArena( )
 	{
 
 #if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
@@ -103,6 +127,31 @@ namespace rss
 
 	}
 
+	// ===========================================================
+	// OPERATORS
+	// ===========================================================
+
+	/**
+	  * Allocates Channel on heap, never in Arena.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pSize - Channel size.
+	  * @return - memory.
+	  * @throws - std::bad_alloc.
+	**/
+	void * Channel::operator new( size_t pSize )
+	{ return( ::operator new( pSize ) ); }
+
+	/**
+	  * Frees Channel memory.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pMemory - memory.
+	  * @throws - no exceptions.
+	**/
+	void Channel::operator delete( void * pMemory ) noexcept
+	{ ::operator delete( pMemory ); }
+
 	// ===========================================================
 	// GETTERS & SETTERS
 	// ===========================================================
@@ -118,26 +167,29 @@ namespace rss
 	Channel::element_ptr_t Channel::getElement( const ElementType pType ) noexcept
 	{
 
-#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
-		// Debug
-		qDebug( ) << "Channel#" << QString::number( id ) << "::getElement";
-#endif // DEBUG
-
-		// Thread-Lock
-		QMutexLocker threadLock( &mElementsMutex );
-
-		// Search Element
-		const auto elementPos = mElements.find( pType );
+		// Published Header.
+		const Header *const header_( mHeader.loadAcquire( ) );
 
-		// Cancel, if Element not found.
-		if ( elementPos == mElements.cend( ) )
+		// Cancel, if no Elements, or Channel can't store this type.
+		if ( header_ == nullptr || pType >= Item::ELEMENT_SLOTS )
 			return( element_ptr_t( nullptr ) );
 
-		// Return Element
-		return( elementPos.value( ) );
+		// Return Element, or null.
+		return( header_->mElements[pType] );
 
 	} /// Channel::getElement
 
+	/**
+	  * Returns Arena of Channel Items & Elements.
+	  * Bound by parser to it's thread (ElementArena::bind).
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - Arena.
+	  * @throws - no exceptions.
+	**/
+	ElementArena & Channel::getArena( ) noexcept
+	{ return( mArena ); }
+
 	/**
 	  * Count Items.
 	  *
@@ -166,7 +218,7 @@ namespace rss
 	  *
 	  * @threadsafe - thread-lock used.
 	  * @param pIndex - Item index.
-	  * @returns - Item, or null.
+	  * @returns - Item, or null if not found or not loaded yet.
 	  * @throws - no exceptions.
 	**/
 	Channel::item_ptr_t Channel::getItem( const int pIndex ) const noexcept
@@ -189,6 +241,85 @@ namespace rss
 
 	} /// Channel::getItem
 
+	/**
+	  * Searches for a record of not loaded Item.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @param pIndex - Item index.
+	  * @param pRecord - Item record, set if found.
+	  * @return - 'true' if Item not loaded & record found.
+	  * @throws - no exceptions.
+	**/
+	bool Channel::getItemRecord( const int pIndex, ItemRecord & pRecord ) const noexcept
+	{
+
+		// Thread-Lock.
+		QMutexLocker uLock( &mItemsMutex );
+
+		// Cancel, if out-of-range, or Item loaded.
+		if ( pIndex < 0 || pIndex >= mItemRecords.size( ) || mItems.at( pIndex ) != nullptr )
+			return( false );
+
+		// Copy Record.
+		pRecord = mItemRecords.at( pIndex );
+
+		// Return TRUE
+		return( true );
+
+	} /// Channel::getItemRecord
+
+	/**
+	  * Returns Items indices, newest first (pubDate).
+	  *
+	  * (?) Items without pubDate, or not loaded, follow dated Items in File order.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @param pSince - epoch (ms, UTC) of oldest Item to return, 0 for all Items.
+	  * Items without pubDate always returned.
+	  * @param pRows - Items indices output.
+	  * @throws - no exceptions.
+	**/
+	void Channel::getItemRows( const qint64 pSince, QVector<int> & pRows ) const noexcept
+	{
+
+		// Thread-Lock.
+		QMutexLocker uLock( &mItemsMutex );
+
+		// Columns.
+		const int count_( mItemFlags.size( ) );
+		const quint8 *const flags_( mItemFlags.constData( ) );
+		const qint64 *const dates_( mItemDates.constData( ) );
+
+		// Items without pubDate.
+		QVector<int> undated_;
+
+		// Filter Items by pubDate.
+		pRows.clear( );
+		pRows.reserve( count_ );
+		for( int i = 0; i < count_; i++ )
+		{
+
+			// Item without pubDate, or not loaded.
+			if ( ( flags_[i] & ITEM_PUB_DATE ) == 0 )
+			{
+				undated_.push_back( i );
+				continue;
+			}
+
+			// Dated Item.
+			if ( dates_[i] >= pSince )
+				pRows.push_back( i );
+
+		} /// Filter Items by pubDate.
+
+		// Sort dated Items, newest first.
+		std::stable_sort( pRows.begin( ), pRows.end( ), [dates_]( const int pA, const int pB ) { return( dates_[pA] > dates_[pB] ); } );
+
+		// Undated Items follow, in File order.
+		pRows += undated_;
+
+	} /// Channel::getItemRows
+
 	/**
 	  * Returns 'true' if RSS Channel's Item with the given GUID found.
 	  *
@@ -247,34 +378,40 @@ namespace rss
 		qDebug( ) << "Channel#" << QString::number( id ) << "::setElement";
 #endif // DEBUG
 
+		// Element-Type.
+		const ElementType type_( pElement->type );
+
+		// Cancel, if Channel can't store this type.
+		if ( type_ >= Item::ELEMENT_SLOTS )
+			return( false );
+
 		// Thread-Lock.
 		QMutexLocker uniqueLock( &mElementsMutex );
 
-		// Search Element.
-		const auto elementPos_ = mElements.find( pElement->type );
+		// Previous Element.
+		const Header *const prevHeader_( mHeader.loadAcquire( ) );
+		const element_ptr_t prevElement_( prevHeader_ != nullptr ? prevHeader_->mElements[type_] : nullptr );
 
 #if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
 		// Check Element Repeat.
 		if ( !pReplace )
-			assert( elementPos_ == mElements.cend( ) && "Channel::setElement - Channel already have such Element ! RSS data corrupt ?" );
+			assert( prevElement_ == nullptr && "Channel::setElement - Channel already have such Element ! RSS data corrupt ?" );
 #else // !DEBUG
 		// Cancel, if Element already stored.
-		if ( !pReplace && elementPos_ != mElements.cend( ) )
+		if ( !pReplace && prevElement_ != nullptr )
 			return( false );
 #endif // DEBUG
 
-		// Delete previous Element.
-		if ( elementPos_ != mElements.cend( ) )
-			delete elementPos_.value( );
+		// Set Element, to own Header of staging Channel, or Header copy.
+		Header *const header_( editHeader( ) );
+		header_->mElements[type_] = pElement;
+		header_->mMask |= 1u << type_;
 
-		// Set Element.
-		mElements[pElement->type] = pElement;
+		// Publish Header.
+		publishHeader( header_ );
 
-		// Remove Element.
-		//mElements.erase( elementPos_ );
-
-		// Add new Element.
-		//mElements.insert( pElement->type, pElement );
+		// Delete, or retire previous Element.
+		retireElement( prevElement_ );
 
 		// Return TRUE
 		return( true );
@@ -317,58 +454,60 @@ namespace rss
 	ElementType Channel::getElementTypeFromString( const QString pType ) noexcept
 	{
 
-		// link
-		if ( pType == "link" )
+		// Resolve Tag.
+		switch( RSSTags::fromName( pType ) )
+		{
+
+		case TAG_LINK:
 			return( ElementType::LINK );
-		else if ( pType == "description" )
+		case TAG_DESCRIPTION:
 			return( ElementType::DESCRITION );
-		else if ( pType == "title" )
+		case TAG_TITLE:
 			return( ElementType::TITLE );
-		else if ( pType == "ttl" )
+		case TAG_TTL:
 			return( ElementType::TTL );
-		else if ( pType == "pubDate" )
+		case TAG_PUB_DATE:
 			return( ElementType::PUB_DATE );
-		else if ( pType == "docs" )
+		case TAG_DOCS:
 			return( ElementType::DOCS );
-		else if ( pType == "guid" )
+		case TAG_GUID:
 			return( ElementType::GUID );
-		else if ( pType == "image" )
+		case TAG_IMAGE:
 			return( ElementType::IMAGE );
-		else if ( pType == "category" )
+		case TAG_CATEGORY:
 			return( ElementType::CATEGORY );
-		else if ( pType == "language" )
+		case TAG_LANGUAGE:
 			return( ElementType::LANGUAGE );
-		else if ( pType == "copyright" )
+		case TAG_COPYRIGHT:
 			return( ElementType::COPYRIGHT );
-		else if ( pType == "managingEditor" )
+		case TAG_MANAGING_EDITOR:
 			return( ElementType::MANAGING_EDITOR );
-		else if ( pType == "lastBuildDate" )
+		case TAG_LAST_BUILD_DATE:
 			return( ElementType::LAST_BUILD_DATE );
-		else if ( pType == "webMaster" )
+		case TAG_WEB_MASTER:
 			return( ElementType::WEB_MASTER );
-		else if ( pType == "textInput" )
+		case TAG_TEXT_INPUT:
 			return( ElementType::TEXT_INPUT );
-		else if ( pType == "skipHours" )
+		case TAG_SKIP_HOURS:
 			return( ElementType::SKIP_HOURS );
-		else if ( pType == "skipDays" )
+		case TAG_SKIP_DAYS:
 			return( ElementType::SKIP_DAYS );
-		else if ( pType == "generator" )
+		case TAG_GENERATOR:
 			return( ElementType::GENERATOR );
-		else if ( pType == "cloud" )
+		case TAG_CLOUD:
 			return( ElementType::CLOUD );
-		else if ( pType == "enclosure" )
+		case TAG_ENCLOSURE:
 			return( ElementType::ENCLOSURE );
-		else if ( pType == "author" )
+		case TAG_AUTHOR:
 			return( ElementType::AUTHOR );
-		else if ( pType == "comments" )
+		case TAG_COMMENTS:
 			return( ElementType::COMMENTS );
-		else if ( pType == "source" )
+		case TAG_SOURCE:
 			return( ElementType::SOURCE );
+		default:
+			break;
 
-#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
-		// Assertion
-		static_assert( "", "Channel::getElementTypeFromString" );
-#endif // DEBUG
+		} /// Resolve Tag.
 
 		// Default
 		return( ElementType::DESCRITION );
@@ -397,12 +536,186 @@ namespace rss
 	  * @throws - no exceptions.
 	**/
 	bool Channel::empty( ) const noexcept
-	{ return( mElements.empty( ) || mItems.empty( ) ); }
+	{
+
+		// Published Header.
+		const Header *const header_( mHeader.loadAcquire( ) );
+
+		// Return 'true' if no Elements or Items.
+		return( header_ == nullptr || header_->mMask == 0 || mItems.empty( ) );
+
+	} /// Channel::empty
+
+	/**
+	  * Returns Header to change: own Header of staging Channel,
+	  * or copy of published Header.
+	  *
+	  * @threadsafe - must be called only when Elements thread-lock is active.
+	  * @return - Header, empty if no Header set.
+	  * @throws - no exceptions.
+	**/
+	Channel::Header * Channel::editHeader( ) noexcept
+	{
+
+		// Current Header.
+		Header *const header_( mHeader.loadAcquire( ) );
+
+		// Staging Channel is read only by parser, Header changed in place.
+		if ( !mPublished && header_ != nullptr )
+			return( header_ );
+
+		// Copy, or create empty Header.
+		return( header_ != nullptr ? new Header( *header_ ) : new Header( ) );
+
+	} /// Channel::editHeader
+
+	/**
+	  * Sets changed Header, replaced Header retired.
+	  * Does nothing, if Header changed in place.
+	  *
+	  * @threadsafe - must be called only when Elements thread-lock is active.
+	  * @param pHeader - Header, returned by #editHeader.
+	  * @throws - no exceptions.
+	**/
+	void Channel::publishHeader( Header *const pHeader ) noexcept
+	{
+
+		// Cancel, if Header changed in place.
+		if ( mHeader.loadAcquire( ) == pHeader )
+			return;
+
+		// Swap Header.
+		Header *const prevHeader_( mHeader.fetchAndStoreOrdered( pHeader ) );
+
+		// Retire replaced Header, readers can still use it until #reclaim.
+		if ( prevHeader_ != nullptr )
+			mRetiredHeaders.push_back( prevHeader_ );
+
+	} /// Channel::publishHeader
+
+	/**
+	  * Deletes replaced Element of staging Channel,
+	  * or retires Element of published Channel.
+	  *
+	  * @threadsafe - must be called only when Elements thread-lock is active.
+	  * @param pElement - replaced Element, or null.
+	  * @throws - no exceptions.
+	**/
+	void Channel::retireElement( element_ptr_t pElement ) noexcept
+	{
+
+		// Cancel, if no Element.
+		if ( pElement == nullptr )
+			return;
+
+		// Views can still use Element of published Channel, until #reclaim.
+		if ( mPublished )
+			mRetiredElements.push_back( pElement );
+		else
+			delete pElement;
+
+	} /// Channel::retireElement
+
+	/**
+	  * Publishes Channel: Channel becomes visible to Views.
+	  * Elements then changed by Header copies, replaced Elements retired.
+	  *
+	  * (?) Called by ChannelModel, when Channel added.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @throws - no exceptions.
+	**/
+	void Channel::publish( ) noexcept
+	{
+
+		// Thread-Locks.
+		QMutexLocker elementsLock( &mElementsMutex );
+		QMutexLocker itemsLock( &mItemsMutex );
+
+		// Set
+		mPublished = true;
+
+	} /// Channel::publish
+
+	/**
+	  * Deletes retired (replaced) Headers, Elements & Items.
+	  *
+	  * (?) Called by ChannelModel at safe point,
+	  * when no View uses Elements & Items read before.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @throws - no exceptions.
+	**/
+	void Channel::reclaim( ) noexcept
+	{
+
+		// Thread-Lock.
+		QMutexLocker elementsLock( &mElementsMutex );
+
+		// Delete retired Elements.
+		for( element_ptr_t element_ : mRetiredElements )
+			delete element_;
+		mRetiredElements.clear( );
+
+		// Delete retired Headers.
+		for( Header * retiredHeader_ : mRetiredHeaders )
+			delete retiredHeader_;
+		mRetiredHeaders.clear( );
+
+		// Thread-Lock.
+		QMutexLocker itemsLock( &mItemsMutex );
+
+		// Delete retired Items.
+		for( item_ptr_t retiredItem_ : mRetiredItems )
+			delete retiredItem_;
+		mRetiredItems.clear( );
+
+	} /// Channel::reclaim
+
+	/**
+	  * Returns 'true' if Items retired since last #reclaim.
+	  * Views must drop retired Items, before they deleted.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @throws - no exceptions.
+	**/
+	bool Channel::hasRetiredItems( ) const noexcept
+	{
+
+		// Thread-Lock.
+		QMutexLocker itemsLock( &mItemsMutex );
+
+		// Return 'true' if retired Items.
+		return( !mRetiredItems.isEmpty( ) );
+
+	} /// Channel::hasRetiredItems
+
+	/**
+	  * Returns 'true' if Items rows changed (added, replaced, removed) since last call.
+	  * Views, keeping Items rows, must read them again.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @throws - no exceptions.
+	**/
+	bool Channel::takeItemsChanged( ) noexcept
+	{
+
+		// Thread-Lock.
+		QMutexLocker itemsLock( &mItemsMutex );
+
+		// Reset
+		const bool result_( mItemsChanged );
+		mItemsChanged = false;
+
+		// Return 'true' if changed.
+		return( result_ );
+
+	} /// Channel::takeItemsChanged
 
 	/**
 	  * Merge (move Elements from source to a destination Channel).
 	  *
-	  * (?) All replaced Elements automatically deleted.
+	  * (?) Replaced Elements deleted, or retired if destination Channel published.
 	  *
 	  * @threadsafe - thread-lock used.
 	  * @param srcChannel - Channel to move Elements from.
@@ -417,28 +730,75 @@ namespace rss
 		qDebug( ) << "Channel#" << dstChannel->id << "::merge";
 #endif // DEBUG
 
-		// Move Elements
-		for( rss::Element * srcElement : srcChannel->mElements )
+		// Take source Header, source Channel is staging & not read.
+		Header *const srcHeader_( srcChannel->mHeader.fetchAndStoreOrdered( nullptr ) );
+
+		// Move Elements, with single Header swap.
+		if ( srcHeader_ != nullptr )
 		{
 
-			// Set Element (override/replace if required).
-			if ( !dstChannel->setElement( srcElement, true ) )
-			{// Element wasn't added.
+			// Thread-Lock.
+			QMutexLocker uniqueLock( &dstChannel->mElementsMutex );
+
+			// Destination Header, copy if published.
+			Header *const dstHeader_( dstChannel->editHeader( ) );
+
+			// Replaced Elements.
+			QVector<element_ptr_t> replaced_;
+
+			// Set Elements (override/replace).
+			for( int i = 0; i < Item::ELEMENT_SLOTS; i++ )
+			{
+
+				// Skip not set Element.
+				if ( srcHeader_->mElements[i] == nullptr )
+					continue;
+
+				// Replace Element.
+				if ( dstHeader_->mElements[i] != nullptr )
+					replaced_.push_back( dstHeader_->mElements[i] );
+				dstHeader_->mElements[i] = srcHeader_->mElements[i];
+
+			} /// Set Elements
 
-				// Delete Element.
-				delete srcElement;
+			// Publish Header.
+			dstHeader_->mMask |= srcHeader_->mMask;
+			dstChannel->publishHeader( dstHeader_ );
 
-			} /// Set Element
+			// Delete, or retire replaced Elements. Views can still read them.
+			for( element_ptr_t element_ : replaced_ )
+				dstChannel->retireElement( element_ );
+
+			// Delete source Header.
+			delete srcHeader_;
 
 		} /// Move Elements
 
-		// Clear Elements collection to move.
-		srcChannel->mElements.clear( );
+		// Remove Items of re-indexed Files, moved records replace them.
+		QVector<QString> indexedPaths_;
+		for( const ItemRecord & record_ : srcChannel->mItemRecords )
+		{
+			if ( !record_.mPath.isEmpty( ) && !indexedPaths_.contains( record_.mPath ) )
+			{
+				indexedPaths_.push_back( record_.mPath );
+				dstChannel->removeItemRecords( record_.mPath );
+			}
+		}
 
 		// Move Items
-		for( rss::Item * srcItem : srcChannel->mItems )
+		for( int i = 0; i < srcChannel->mItems.size( ); i++ )
 		{
 
+			// Get Item.
+			rss::Item *const srcItem( srcChannel->mItems.at( i ) );
+
+			// Move record of not loaded Item.
+			if ( srcItem == nullptr )
+			{
+				dstChannel->addItemRecord( srcChannel->mItemRecords.at( i ) );
+				continue;
+			}
+
 			// Move Item
 			if ( !dstChannel->addItem( srcItem ) )
 			{// Item not added.
@@ -452,6 +812,14 @@ namespace rss
 
 		// Clear Items to Move.
 		srcChannel->mItems.clear( );
+		srcChannel->mItemRecords.clear( );
+		srcChannel->mItemGuids.clear( );
+		srcChannel->mItemDates.clear( );
+		srcChannel->mItemTitles.clear( );
+		srcChannel->mItemFlags.clear( );
+
+		// Take memory of moved Items & Elements.
+		dstChannel->mArena.adopt( srcChannel->mArena );
 
 	} /// Channel::merge
 
@@ -481,20 +849,184 @@ namespace rss
 		qDebug( ) << "Channel#" << QString::number( id ) << "::searchItemByGUID";
 #endif // DEBUG
 
-		// Search Item
-		for( item_ptr_t item_ : mItems )
+		// Search Item index.
+		const int index_( findItemByGUID( pGUID ) );
+
+		// Return Item, or null.
+		return( index_ < 0 ? item_ptr_t( nullptr ) : mItems.at( index_ ) );
+
+	} /// Channel::searchItemByGUID
+
+	/**
+	  * Searches index of a Item with the specific GUID, using GUID hashes column.
+	  *
+	  * @threadsafe - must be called only when thread-lock is active.
+	  * @param pGUID - Item's GUID.
+	  * @return - Item index, or -1.
+	  * @throws - no exceptions.
+	**/
+	int Channel::findItemByGUID( const QString & pGUID ) const noexcept
+	{
+
+		// GUID hash.
+		const uint hash_( qHash( pGUID ) );
+
+		// Columns.
+		const int count_( mItemGuids.size( ) );
+		const uint *const guids_( mItemGuids.constData( ) );
+		const quint8 *const flags_( mItemFlags.constData( ) );
+
+		// Search hash, compare GUID only when hashes equal.
+		for( int i = 0; i < count_; i++ )
 		{
 
-			// Comparison
-			if ( static_cast<rss::GUID*>( item_->getElement( ElementType::GUID ) )->mData == pGUID )
-				return( item_ );
+			// Skip other hash, or Item without GUID.
+			if ( guids_[i] != hash_ || ( flags_[i] & ITEM_GUID ) == 0 )
+				continue;
 
-		} /// Search Item
+			// Compare GUID.
+			if ( static_cast<rss::GUID*>( mItems.at( i )->getElement( ElementType::GUID ) )->mData == pGUID )
+				return( i );
 
-		// Return null.
-		return( item_ptr_t( nullptr ) );
+		} /// Search hash.
 
-	} /// Channel::searchItemByGUID
+		// Not found.
+		return( -1 );
+
+	} /// Channel::findItemByGUID
+
+	/**
+	  * Sets Item columns. Columns grown, if index is Items count.
+	  *
+	  * @threadsafe - must be called only when thread-lock is active.
+	  * @param pIndex - Item index.
+	  * @param pItem - Item, or null if not loaded.
+	  * @throws - no exceptions.
+	**/
+	void Channel::setItemColumns( const int pIndex, const Item *const pItem ) noexcept
+	{
+
+		// Grow columns.
+		if ( pIndex == mItemFlags.size( ) )
+		{
+			mItemGuids.push_back( 0 );
+			mItemDates.push_back( 0 );
+			mItemTitles.push_back( QString( ) );
+			mItemFlags.push_back( 0 );
+		}
+
+		// Not loaded Item has empty columns.
+		if ( pItem == nullptr )
+			return;
+
+		// Flags
+		quint8 flags_( ITEM_LOADED );
+
+		// GUID hash.
+		const rss::GUID *const guid_( static_cast<rss::GUID*>( pItem->getElement( ElementType::GUID ) ) );
+		if ( guid_ != nullptr )
+		{
+			mItemGuids[pIndex] = qHash( guid_->mData );
+			flags_ |= ITEM_GUID;
+		}
+
+		// pubDate epoch.
+		const rss::PubDate *const pubDate_( static_cast<rss::PubDate*>( pItem->getElement( ElementType::PUB_DATE ) ) );
+		if ( pubDate_ != nullptr && pubDate_->mEpoch != 0 )
+		{
+			mItemDates[pIndex] = pubDate_->mEpoch;
+			flags_ |= ITEM_PUB_DATE;
+		}
+
+		// Title, shared with Element.
+		const rss::Title *const title_( static_cast<rss::Title*>( pItem->getElement( ElementType::TITLE ) ) );
+		if ( title_ != nullptr )
+			mItemTitles[pIndex] = title_->getData( );
+
+		// Set flags.
+		mItemFlags[pIndex] = flags_;
+
+	} /// Channel::setItemColumns
+
+	/**
+	  * Removes Items, indexed from File before. File indexed again, new records replace them.
+	  * Loaded Items retired.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @param pPath - File-Path.
+	  * @throws - no exceptions.
+	**/
+	void Channel::removeItemRecords( const QString & pPath ) noexcept
+	{
+
+		// Thread-Lock
+		QMutexLocker threadLock( &mItemsMutex );
+
+		// Cancel, if no records.
+		if ( mItemRecords.isEmpty( ) )
+			return;
+
+		// Number of kept Items.
+		int kept_( 0 );
+
+		// Compact Items, records & columns.
+		for( int i = 0; i < mItems.size( ); i++ )
+		{
+
+			// Remove Item of re-indexed File. Views can still use loaded Item.
+			if ( i < mItemRecords.size( ) && mItemRecords.at( i ).mPath == pPath )
+			{
+				if ( mItems.at( i ) != nullptr )
+					retireItem( mItems.at( i ) );
+				continue;
+			}
+
+			// Keep Item.
+			if ( kept_ != i )
+			{
+				mItems[kept_] = mItems.at( i );
+				mItemRecords[kept_] = mItemRecords.at( i );
+				mItemGuids[kept_] = mItemGuids.at( i );
+				mItemDates[kept_] = mItemDates.at( i );
+				mItemTitles[kept_] = mItemTitles.at( i );
+				mItemFlags[kept_] = mItemFlags.at( i );
+			}
+			kept_++;
+
+		} /// Compact Items.
+
+		// Rows changed.
+		if ( kept_ != mItems.size( ) )
+			mItemsChanged |= mPublished;
+
+		// Remove tail.
+		mItems.resize( kept_ );
+		mItemRecords.resize( kept_ );
+		mItemGuids.resize( kept_ );
+		mItemDates.resize( kept_ );
+		mItemTitles.resize( kept_ );
+		mItemFlags.resize( kept_ );
+
+	} /// Channel::removeItemRecords
+
+	/**
+	  * Deletes replaced Item of staging Channel,
+	  * or retires Item of published Channel.
+	  *
+	  * @threadsafe - must be called only when Items thread-lock is active.
+	  * @param pItem - replaced Item.
+	  * @throws - no exceptions.
+	**/
+	void Channel::retireItem( item_ptr_t pItem ) noexcept
+	{
+
+		// Views can still use Item of published Channel, until #reclaim.
+		if ( mPublished )
+			mRetiredItems.push_back( pItem );
+		else
+			delete pItem;
+
+	} /// Channel::retireItem
 
 	/**
 	  * Adds Item to Channel.
@@ -518,24 +1050,110 @@ namespace rss
 		// Get GUID
 		const rss::GUID *const guid_ptr( static_cast<rss::GUID*>( pItem->getElement( ElementType::GUID ) ) );
 
-		// Get Item.
-		rss::Item *const prevItem_( guid_ptr != nullptr ? getItemByGUID( guid_ptr->mData ) : nullptr );
+		// Thread-Lock
+		QMutexLocker threadLock( &mItemsMutex );
+
+		// Get Item index.
+		const int prevIndex_( guid_ptr != nullptr ? findItemByGUID( guid_ptr->mData ) : -1 );
 
 		// GUID-Check.
-		if ( prevItem_ != nullptr && !rss::Item::isNewer( pItem, prevItem_ ) )
-			return( false );
+		if ( prevIndex_ >= 0 )
+		{
 
-		// Thread-Lock
-		QMutexLocker threadLock( &mItemsMutex );
+			// Cancel, if added Item is not newer.
+			if ( !rss::Item::isNewer( pItem, mItems.at( prevIndex_ ) ) )
+				return( false );
+
+			// Replace Item, replaced Item retired.
+			retireItem( mItems.at( prevIndex_ ) );
+			mItems[prevIndex_] = pItem;
+			setItemColumns( prevIndex_, pItem );
+			mItemsChanged |= mPublished;
+
+			// Return TRUE
+			return( true );
+
+		} /// GUID-Check.
 
 		// Add Item.
+		setItemColumns( mItems.size( ), pItem );
 		mItems.push_back( pItem );
+		mItemsChanged |= mPublished;
+
+		// Keep records aligned with Items.
+		if ( !mItemRecords.isEmpty( ) )
+			mItemRecords.resize( mItems.size( ) );
 
 		// Return TRUE
 		return( true );
 
 	} /// Channel::addItem
 
+	/**
+	  * Adds record of not loaded Item to Channel.
+	  *
+	  * (?) Used only by RSS parser. Item not checked for GUID dublicates,
+	  * records of re-indexed File replaced, when staging Channel merged.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @param pRecord - Item record.
+	  * @throws - no exceptions.
+	**/
+	void Channel::addItemRecord( const ItemRecord & pRecord ) noexcept
+	{
+
+		// Thread-Lock
+		QMutexLocker threadLock( &mItemsMutex );
+
+		// Align records with Items, added before first record.
+		mItemRecords.resize( mItems.size( ) );
+
+		// Add record & empty Item slot.
+		mItemRecords.push_back( pRecord );
+		setItemColumns( mItems.size( ), nullptr );
+		mItems.push_back( nullptr );
+		mItemsChanged |= mPublished;
+
+	} /// Channel::addItemRecord
+
+	/**
+	  * Sets loaded Item, replacing Item record.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @param pIndex - Item index.
+	  * @param pItem - loaded Item. Deleted, if Item already loaded by other caller.
+	  * @return - Item, or null if out-of-range.
+	  * @throws - no exceptions.
+	**/
+	Channel::item_ptr_t Channel::setLoadedItem( const int pIndex, item_ptr_t pItem ) noexcept
+	{
+
+		// Thread-Lock
+		QMutexLocker threadLock( &mItemsMutex );
+
+		// Cancel, if out-of-range.
+		if ( pIndex < 0 || pIndex >= mItems.size( ) )
+		{
+			delete pItem;
+			return( nullptr );
+		}
+
+		// Keep Item, loaded by other caller.
+		if ( mItems.at( pIndex ) != nullptr )
+		{
+			delete pItem;
+			return( mItems.at( pIndex ) );
+		}
+
+		// Set Item.
+		mItems[pIndex] = pItem;
+		setItemColumns( pIndex, pItem );
+
+		// Return Item.
+		return( pItem );
+
+	} /// Channel::setLoadedItem
+
 	/**
 	  * Removes all Items (delete).
 	  *
@@ -555,6 +1173,18 @@ namespace rss
 		// Thread-Lock
 		QMutexLocker threadLock( &mItemsMutex );
 
+		// Release records of not loaded Items & columns.
+		mItemRecords.clear( );
+		mItemGuids.clear( );
+		mItemDates.clear( );
+		mItemTitles.clear( );
+		mItemFlags.clear( );
+
+		// Delete retired Items.
+		for( item_ptr_t retiredItem_ : mRetiredItems )
+			delete retiredItem_;
+		mRetiredItems.clear( );
+
 		// Cancel, if Items collection (container) is empty.
 		if ( mItems.empty( ) )
 			return;
@@ -575,14 +1205,7 @@ namespace rss
 			// Get Item.
 			item_ptr = *itemsIter_;
 
-#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
-
-			// Null-Check
-			assert( item_ptr != nullptr && "Channel::releaseItems - Item is null !" );
-
-#endif // DEBUG
-
-			// Delete Item
+			// Delete Item, null if not loaded.
 			delete item_ptr;
 
 			// Next Item
@@ -614,43 +1237,31 @@ namespace rss
 		// Thread-Lock
 		QMutexLocker threadLock( &mElementsMutex );
 
-		// Cancel, if Elements collection (container) is empty.
-		if ( mElements.empty( ) )
-			return;
-
-		// Elements map Iterator.
-		auto elementsIter_ = mElements.begin( );
+		// Unpublish Header.
+		Header *const header_( mHeader.fetchAndStoreOrdered( nullptr ) );
 
-		// Elements map End-Iterator.
-		const auto elementsEndIter_ = mElements.cend( );
-
-		// Element
-		element_ptr_t element_ptr( nullptr );
-
-		// Remove Elements
-		while( elementsIter_ != elementsEndIter_ )
+		// Delete Elements & Header.
+		if ( header_ != nullptr )
 		{
 
-			// Get Item.
-			element_ptr = elementsIter_.value( );
-
-#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+			// Delete Elements
+			for( element_ptr_t element_ : header_->mElements )
+				delete element_;
 
-			// Null-Check
-			assert( element_ptr != nullptr && "Channel::releaseElements - Element is null !" );
+			// Delete Header
+			delete header_;
 
-			// Delete Item
-			delete element_ptr;
-
-#endif // DEBUG
-
-			// Next Item
-			elementsIter_++;
+		} /// Delete Elements & Header.
 
-		} /// Remove Elements
+		// Delete retired Elements.
+		for( element_ptr_t element_ : mRetiredElements )
+			delete element_;
+		mRetiredElements.clear( );
 
-		// Clear Elements Collection (container).
-		mElements.clear( );
+		// Delete retired Headers.
+		for( Header * retiredHeader_ : mRetiredHeaders )
+			delete retiredHeader_;
+		mRetiredHeaders.clear( );
 
 	} ///Channel::releaseElements
 
@@ -32,10 +32,10 @@
 #include <QString>
 #endif // !QSTRING_H
 
-// Include QMap
-#ifndef QMAP_H
-#include <QMap>
-#endif // !QMAP_H
+// Include QAtomicPointer
+#ifndef QATOMIC_H
+#include <QAtomicPointer>
+#endif // !QATOMIC_H
 
 // Include QVector
 #ifndef QVECTOR_H
@@ -52,6 +52,11 @@
 #include "Item.hpp"
 #endif // !QRSS_READER_ITEM_HPP
 
+// Include rss::ElementArena
+#ifndef QRSS_READER_ELEMENT_ARENA_HPP
+#include "../utils/ElementArena.hpp"
+#endif // !QRSS_READER_ELEMENT_ARENA_HPP
+
 // ===========================================================
 // Channel
 // ===========================================================
@@ -71,6 +76,17 @@ namespace rss
 	  * (?) This class designed to be thread-safe, in case if data read (extracted) while
 	  * updating.
 	  * <br>
+	  * (?) Elements kept in immutable Header block, published atomically.
+	  * Elements read without thread-lock, writers copy Header & swap it.
+	  * Staging Channel (not published yet) changes own Header in place.
+	  * Replaced Headers & Elements retired, deleted by #reclaim at safe point.
+	  * <br>
+	  * (?) Items columns (GUID hash, pubDate epoch, Title, flags) kept parallel to Items,
+	  * so dedup, date filtering & sorting scan contiguous arrays, not Items Elements.
+	  * <br>
+	  * (?) Items & Elements, created while Channel parsed, allocated from Channel Arena
+	  * & freed with Channel. Channel itself allocated on heap.
+	  * <br>
 	  * (?) Designed to support RSS 2.0
 	  *
 	  * @version 1.0
@@ -94,6 +110,41 @@ namespace rss
 		/** Alias for Element pointer. **/
 		using element_ptr_t = Element*;
 
+		// ===========================================================
+		// ItemRecord
+		// ===========================================================
+
+		/**
+		  * Location of not loaded Item in RSS-file.
+		  * Item loaded (materialized) from these bytes, when requested.
+		  * File size & modification time checked, so rewritten File not read by old offsets.
+		**/
+		struct ItemRecord
+		{
+
+			/** File-Path. **/
+			QString mPath;
+
+			/** File size, when Item indexed. **/
+			qint64 mFileSize;
+
+			/** File modification time (ms since epoch), when Item indexed. **/
+			qint64 mModified;
+
+			/** Offset of '<item' in File. **/
+			qint64 mOffset;
+
+			/** Number of bytes, including </item>. **/
+			int mLength;
+
+			/** Parent-Element Tag (<channel>, <feed>, <rdf:RDF>). **/
+			RSSTag mParentTag;
+
+			/** Table of Document single-byte charset (CharsetDecoder), null for UTF-8. Item bytes have no Xml-declaration. **/
+			const ushort * mCharset;
+
+		}; /// ItemRecord
+
 		// ===========================================================
 		// CONSTANTS
 		// ===========================================================
@@ -111,18 +162,93 @@ namespace rss
 		// FIELDS
 		// ===========================================================
 
-		/** Elements. **/
-		QMap<ElementType, element_ptr_t> mElements;
+		/**
+		  * Header - immutable block of Channel Elements, indexed by ElementType.
+		  * Never changed after published, replaced by a copy.
+		**/
+		struct Header
+		{
+
+			/** Elements, null if not set. **/
+			element_ptr_t mElements[Item::ELEMENT_SLOTS];
 
-		/** Elements Thread-Lock. **/
+			/** Set Elements bits (1 << ElementType). **/
+			quint32 mMask;
+
+		}; /// Header
+
+		/** Published Header, null if no Elements set. **/
+		QAtomicPointer<Header> mHeader;
+
+		/**
+		  * Replaced Headers, can be still read by other threads.
+		  * Deleted by #reclaim, or with Elements.
+		**/
+		QVector<Header*> mRetiredHeaders;
+
+		/**
+		  * Replaced Elements, can be still read by other threads.
+		  * Deleted by #reclaim, or with Elements.
+		**/
+		QVector<element_ptr_t> mRetiredElements;
+
+		/** 'true' when Channel published (visible to Views). Staging Channel Header changed in place. **/
+		bool mPublished;
+
+		/** Elements writers Thread-Lock. **/
 		mutable QMutex mElementsMutex;
 
-		/** Items. **/
+		/** Items. Null for Item which is not loaded yet. **/
 		QVector<item_ptr_t> mItems;
 
+		/**
+		  * Records of not loaded Items, same indices as #mItems.
+		  * Empty, if all Items loaded when parsed.
+		**/
+		QVector<ItemRecord> mItemRecords;
+
+		/** Items columns flags. **/
+		enum ItemFlag : quint8
+		{
+
+			/** Item loaded, columns set. **/
+			ITEM_LOADED = 1,
+
+			/** Item has GUID. **/
+			ITEM_GUID = 2,
+
+			/** Item has parsed pubDate. **/
+			ITEM_PUB_DATE = 4
+
+		}; /// ItemFlag
+
+		/** Items GUID hashes (qHash), same indices as #mItems. **/
+		QVector<uint> mItemGuids;
+
+		/** Items pubDate epochs (ms, UTC), same indices as #mItems. **/
+		QVector<qint64> mItemDates;
+
+		/** Items Titles (shared with Title Elements), same indices as #mItems. **/
+		QVector<QString> mItemTitles;
+
+		/** Items flags (ItemFlag), same indices as #mItems. **/
+		QVector<quint8> mItemFlags;
+
+		/**
+		  * Items, replaced by newer Items with the same GUID, or removed by re-indexing.
+		  * Views can still use them, deleted by #reclaim, or with Items.
+		**/
+		QVector<item_ptr_t> mRetiredItems;
+
+		/** 'true' if Items rows of published Channel changed (added, replaced, removed) since last #takeItemsChanged. **/
+		bool mItemsChanged;
+
 		/** Items Thread-Lock. **/
 		mutable QMutex mItemsMutex;
 
+		/** Memory of Items & Elements, freed after them. **/
+		ElementArena mArena;
+
 		// ===========================================================
 		// DELETED CONSTRUCTORS & OPERATORS
 		// ===========================================================
@@ -153,6 +279,76 @@ namespace rss
 		**/
 		item_ptr_t searchItemByGUID( const QString & pGUID ) const noexcept;
 
+		/**
+		  * Searches index of a Item with the specific GUID, using GUID hashes column.
+		  *
+		  * @threadsafe - must be called only when thread-lock is active.
+		  * @param pGUID - Item's GUID.
+		  * @return - Item index, or -1.
+		  * @throws - no exceptions.
+		**/
+		int findItemByGUID( const QString & pGUID ) const noexcept;
+
+		/**
+		  * Sets Item columns. Columns grown, if index is Items count.
+		  *
+		  * @threadsafe - must be called only when thread-lock is active.
+		  * @param pIndex - Item index.
+		  * @param pItem - Item, or null if not loaded.
+		  * @throws - no exceptions.
+		**/
+		void setItemColumns( const int pIndex, const Item *const pItem ) noexcept;
+
+		/**
+		  * Removes Items, indexed from File before. File indexed again, new records replace them.
+		  * Loaded Items retired.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pPath - File-Path.
+		  * @throws - no exceptions.
+		**/
+		void removeItemRecords( const QString & pPath ) noexcept;
+
+		/**
+		  * Deletes replaced Item of staging Channel,
+		  * or retires Item of published Channel.
+		  *
+		  * @threadsafe - must be called only when Items thread-lock is active.
+		  * @param pItem - replaced Item.
+		  * @throws - no exceptions.
+		**/
+		void retireItem( item_ptr_t pItem ) noexcept;
+
+		/**
+		  * Returns Header to change: own Header of staging Channel,
+		  * or copy of published Header.
+		  *
+		  * @threadsafe - must be called only when Elements thread-lock is active.
+		  * @return - Header, empty if no Header set.
+		  * @throws - no exceptions.
+		**/
+		Header * editHeader( ) noexcept;
+
+		/**
+		  * Sets changed Header, replaced Header retired.
+		  * Does nothing, if Header changed in place.
+		  *
+		  * @threadsafe - must be called only when Elements thread-lock is active.
+		  * @param pHeader - Header, returned by #editHeader.
+		  * @throws - no exceptions.
+		**/
+		void publishHeader( Header *const pHeader ) noexcept;
+
+		/**
+		  * Deletes replaced Element of staging Channel,
+		  * or retires Element of published Channel.
+		  *
+		  * @threadsafe - must be called only when Elements thread-lock is active.
+		  * @param pElement - replaced Element, or null.
+		  * @throws - no exceptions.
+		**/
+		void retireElement( element_ptr_t pElement ) noexcept;
+
 		// -----------------------------------------------------------
 
 	public:
@@ -182,6 +378,29 @@ namespace rss
 		**/
 		~Channel( ) noexcept;
 
+		// ===========================================================
+		// OPERATORS
+		// ===========================================================
+
+		/**
+		  * Allocates Channel on heap, never in Arena.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pSize - Channel size.
+		  * @return - memory.
+		  * @throws - std::bad_alloc.
+		**/
+		static void * operator new( size_t pSize );
+
+		/**
+		  * Frees Channel memory.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pMemory - memory.
+		  * @throws - no exceptions.
+		**/
+		static void operator delete( void * pMemory ) noexcept;
+
 		// ===========================================================
 		// GETTERS & SETTERS
 		// ===========================================================
@@ -189,13 +408,23 @@ namespace rss
 		/**
 		  * Searches for a Element.
 		  *
-		  * @thread_safety - thread-lock used.
+		  * @thread_safety - thread-safe, wait-free (published Header read).
 		  * @param pType - Element-Type.
 		  * @return - Element, or null.
 		  * @throws - no exceptions.
 		**/
 		element_ptr_t getElement( const ElementType pType ) noexcept;
 
+		/**
+		  * Returns Arena of Channel Items & Elements.
+		  * Bound by parser to it's thread (ElementArena::bind).
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - Arena.
+		  * @throws - no exceptions.
+		**/
+		ElementArena & getArena( ) noexcept;
+
 		/**
 		  * Count Items.
 		  *
@@ -210,11 +439,35 @@ namespace rss
 		  *
 		  * @threadsafe - thread-lock used.
 		  * @param pIndex - Item index.
-		  * @returns - Item, or null.
+		  * @returns - Item, or null if not found or not loaded yet.
 		  * @throws - no exceptions.
 		**/
 		item_ptr_t getItem( const int pIndex ) const noexcept;
 
+		/**
+		  * Searches for a record of not loaded Item.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pIndex - Item index.
+		  * @param pRecord - Item record, set if found.
+		  * @return - 'true' if Item not loaded & record found.
+		  * @throws - no exceptions.
+		**/
+		bool getItemRecord( const int pIndex, ItemRecord & pRecord ) const noexcept;
+
+		/**
+		  * Returns Items indices, newest first (pubDate).
+		  *
+		  * (?) Items without pubDate, or not loaded, follow dated Items in File order.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pSince - epoch (ms, UTC) of oldest Item to return, 0 for all Items.
+		  * Items without pubDate always returned.
+		  * @param pRows - Items indices output.
+		  * @throws - no exceptions.
+		**/
+		void getItemRows( const qint64 pSince, QVector<int> & pRows ) const noexcept;
+
 		/**
 		  * Returns 'true' if RSS Channel's Item with the given GUID found.
 		  *
@@ -239,7 +492,7 @@ namespace rss
 		/**
 		  * Returns 'true' if Channel have Element with a provided Element-Type.
 		  *
-		  * @threadsafe - thread-lock used.
+		  * @threadsafe - thread-safe, wait-free.
 		  * @param pType - Element-Type.
 		  * @throws - no exceptions.
 		**/
@@ -291,7 +544,7 @@ namespace rss
 		/**
 		  * Merge (move Elements from source to a destination Channel).
 		  *
-		  * (?) All replaced Elements automatically deleted.
+		  * (?) Replaced Elements deleted, or retired if destination Channel published.
 		  *
 		  * @threadsafe - thread-lock used.
 		  * @param srcChannel - Channel to move Elements from.
@@ -300,6 +553,46 @@ namespace rss
 		**/
 		static void merge( rss::Channel *const srcChannel, rss::Channel *const dstChannel ) noexcept;
 
+		/**
+		  * Publishes Channel: Channel becomes visible to Views.
+		  * Elements then changed by Header copies, replaced Elements retired.
+		  *
+		  * (?) Called by ChannelModel, when Channel added.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @throws - no exceptions.
+		**/
+		void publish( ) noexcept;
+
+		/**
+		  * Deletes retired (replaced) Headers, Elements & Items.
+		  *
+		  * (?) Called by ChannelModel at safe point,
+		  * when no View uses Elements & Items read before.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @throws - no exceptions.
+		**/
+		void reclaim( ) noexcept;
+
+		/**
+		  * Returns 'true' if Items retired since last #reclaim.
+		  * Views must drop retired Items, before they deleted.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @throws - no exceptions.
+		**/
+		bool hasRetiredItems( ) const noexcept;
+
+		/**
+		  * Returns 'true' if Items rows changed (added, replaced, removed) since last call.
+		  * Views, keeping Items rows, must read them again.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @throws - no exceptions.
+		**/
+		bool takeItemsChanged( ) noexcept;
+
 		/**
 		  * Count sub-Elements.
 		  *
@@ -316,12 +609,36 @@ namespace rss
 		  *
 		  * @threadsafe - thread-lock used.
 		  * @param pItem - Item.
-		  * @return - 'true' if added, 'false' if Item with the same GUID already added.</br>
+		  * @return - 'true' if added, or replaced older Item with the same GUID.
+		  * 'false' if Item with the same GUID & newer pubDate already added.</br>
 		  * Use #hasItem(const QString&) method.
 		  * @throws - no exceptions.
 		**/
 		bool addItem( item_ptr_t pItem ) noexcept;
 
+		/**
+		  * Adds record of not loaded Item to Channel.
+		  *
+		  * (?) Used only by RSS parser. Item not checked for GUID dublicates,
+		  * records of re-indexed File replaced, when staging Channel merged.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pRecord - Item record.
+		  * @throws - no exceptions.
+		**/
+		void addItemRecord( const ItemRecord & pRecord ) noexcept;
+
+		/**
+		  * Sets loaded Item, replacing Item record.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pIndex - Item index.
+		  * @param pItem - loaded Item. Deleted, if Item already loaded by other caller.
+		  * @return - Item, or null if out-of-range.
+		  * @throws - no exceptions.
+		**/
+		item_ptr_t setLoadedItem( const int pIndex, item_ptr_t pItem ) noexcept;
+
 		/**
 		  * Removes all Items (delete).
 		  *
@@ -34,6 +34,89 @@
 #include "../utils/SAXRSSHandler.hpp"
 #endif // !QRSS_READER_SAX_RSS_HANDLER_HPP
 
+// Include rss::StreamRSSReader
+#ifndef QRSS_READER_STREAM_RSS_READER_HPP
+#include "../utils/StreamRSSReader.hpp"
+#endif // !QRSS_READER_STREAM_RSS_READER_HPP
+
+// Include rss::FastRSSScanner
+#ifndef QRSS_READER_FAST_RSS_SCANNER_HPP
+#include "../utils/FastRSSScanner.hpp"
+#endif // !QRSS_READER_FAST_RSS_SCANNER_HPP
+
+// Include rss::GzipDevice
+#ifndef QRSS_READER_GZIP_DEVICE_HPP
+#include "../utils/GzipDevice.hpp"
+#endif // !QRSS_READER_GZIP_DEVICE_HPP
+
+// Include QFile
+#ifndef QFILE_H
+#include <QFile>
+#endif // !QFILE_H
+
+// Include QTimer
+#ifndef QTIMER_H
+#include <QTimer>
+#endif // !QTIMER_H
+
+// Include QBuffer
+#ifndef QBUFFER_H
+#include <QBuffer>
+#endif // !QBUFFER_H
+
+// Include QRunnable
+#ifndef QRUNNABLE_H
+#include <QRunnable>
+#endif // !QRUNNABLE_H
+
+// Include QThreadPool
+#ifndef QTHREADPOOL_H
+#include <QThreadPool>
+#endif // !QTHREADPOOL_H
+
+// Include QFileSystemWatcher
+#ifndef QFILESYSTEMWATCHER_H
+#include <QFileSystemWatcher>
+#endif // !QFILESYSTEMWATCHER_H
+
+// Include QDir
+#ifndef QDIR_H
+#include <QDir>
+#endif // !QDIR_H
+
+// Include QFileInfo
+#ifndef QFILEINFO_H
+#include <QFileInfo>
+#endif // !QFILEINFO_H
+
+// Include QDateTime
+#ifndef QDATETIME_H
+#include <QDateTime>
+#endif // !QDATETIME_H
+
+// Include rss::XXHash64
+#ifndef QRSS_READER_XXHASH64_HPP
+#include "../utils/XXHash64.hpp"
+#endif // !QRSS_READER_XXHASH64_HPP
+
+// Include rss::ElementPool
+#ifndef QRSS_READER_ELEMENT_POOL_HPP
+#include "../utils/ElementPool.hpp"
+#endif // !QRSS_READER_ELEMENT_POOL_HPP
+
+// Include QThread
+#ifndef QTHREAD_H
+#include <QThread>
+#endif // !QTHREAD_H
+
+// Include QElapsedTimer
+#ifndef QELAPSEDTIMER_H
+#include <QElapsedTimer>
+#endif // !QELAPSEDTIMER_H
+
+// Include C++ limits.
+#include <limits>
+
 #if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
 
 // Include QDebug
@@ -52,6 +135,250 @@ namespace rss
 
 	// -----------------------------------------------------------
 
+	// ===========================================================
+	// ParseTask
+	// ===========================================================
+
+	/**
+	  * ParseTask - parses one RSS-file on a thread-pool to a staging Channel.
+	  *
+	  * @brief
+	  * Task owns Handler & Channel, so workers share nothing,
+	  * except Elements ID Storage (thread-locked).
+	**/
+	class ChannelModel::ParseTask final : public QRunnable
+	{
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** File-Path. **/
+		const QString mPath;
+
+		/** ParserEngine. **/
+		const int mEngine;
+
+		/** Parsing limits. **/
+		const ParseLimits mLimits;
+
+		/** 'true' if malformed Items dropped. **/
+		const bool mRecovery;
+
+		/** Parsing problems. **/
+		ParseDiagnostics mDiagnostics;
+
+		/** Parsing statistics. **/
+		ParseStats mStats;
+
+		/** Fingerprint of File bytes, when File read last time. 0 if not read. **/
+		const quint64 mPrevFingerprint;
+
+		/** Fingerprint of File bytes. **/
+		quint64 mFingerprint;
+
+		/** Hashes of Items, read from File last time. **/
+		const QSet<quint64> mKnownItems;
+
+		/** Hashes of Items, read from File. **/
+		QSet<quint64> mItemHashes;
+
+		/** Staging Channel. Null if File not parsed, or taken. **/
+		rss::Channel * mChannel;
+
+		/** Model, notified when File parsed (#onScanTaskFinished). Null, if Model waits for Task. **/
+		ChannelModel *const mModel;
+
+		/** Id of watched directory reading. **/
+		const int mScanId;
+
+		// ===========================================================
+		// DELETED CONSTRUCTORS & OPERATORS
+		// ===========================================================
+
+		/** @deleted ParseTask const copy constructor. **/
+		ParseTask( const ParseTask & ) noexcept = delete;
+
+		/** @deleted ParseTask copy-assignment operator. **/
+		ParseTask & operator=( const ParseTask & ) noexcept = delete;
+
+		/** @deleted ParseTask move constructor. **/
+		ParseTask( ParseTask && ) noexcept = delete;
+
+		/** @deleted ParseTask move assignment operator. **/
+		ParseTask & operator=( ParseTask && ) noexcept = delete;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		/**
+		  * ParseTask constructor.
+		  *
+		  * @param pPath - File-Path.
+		  * @param pEngine - ParserEngine.
+		  * @param pLimits - parsing limits.
+		  * @param pRecovery - 'true' to drop malformed Items.
+		  * @param pFingerprint - fingerprint of File bytes, when File read last time. 0 if not read.
+		  * @param pKnownItems - hashes of Items, read from File last time.
+		  * @param pModel - Model, notified when File parsed. Null, if Model waits for Task.
+		  * @param pScanId - Id of watched directory reading.
+		  * @throws - no exceptions.
+		**/
+		explicit ParseTask( const QString & pPath, const int pEngine, const ParseLimits & pLimits, const bool pRecovery, const quint64 pFingerprint, const QSet<quint64> & pKnownItems, ChannelModel *const pModel = nullptr, const int pScanId = 0 ) noexcept
+			: QRunnable( ),
+			  mPath( pPath ),
+			  mEngine( pEngine ),
+			  mLimits( pLimits ),
+			  mRecovery( pRecovery ),
+			  mDiagnostics( ),
+			  mStats( ),
+			  mPrevFingerprint( pFingerprint ),
+			  mFingerprint( 0 ),
+			  mKnownItems( pKnownItems ),
+			  mItemHashes( ),
+			  mChannel( nullptr ),
+			  mModel( pModel ),
+			  mScanId( pScanId )
+		{
+
+			// Task deleted by ChannelModel, after Channel taken.
+			setAutoDelete( false );
+
+		}
+
+		/**
+		  * ParseTask destructor.
+		  *
+		  * @throws - no exceptions.
+		**/
+		virtual ~ParseTask( ) noexcept override
+		{ delete mChannel; }
+
+		/**
+		  * Parses File. Called by thread-pool.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @throws - no exceptions.
+		**/
+		virtual void run( ) override
+		{
+
+			// Create staging SAXRSSHandler, without Model.
+			rss::SAXRSSHandler rssHandler( nullptr, nullptr );
+
+			// Set Limits & recovery mode.
+			rssHandler.setLimits( mLimits );
+			rssHandler.setRecovery( mRecovery );
+			rssHandler.setKnownItems( mKnownItems );
+
+			// Channel Arena used only when File read first time.
+			rssHandler.setUseArena( mPrevFingerprint == 0 );
+
+			// Create QFile.
+			QFile rssFile( mPath );
+
+			// Parse File. File with the same bytes skipped.
+			ChannelModel::parseFile( rssFile, rssHandler, mEngine, mPrevFingerprint, mFingerprint );
+
+			// Keep parsed Channel, problems & statistics.
+			mChannel = rssHandler.getChannel( );
+			mDiagnostics = rssHandler.getDiagnostics( );
+			mStats = rssHandler.getStats( );
+			mItemHashes.swap( rssHandler.getItemHashes( ) );
+
+			// Notify Model on GUI-thread. Task members not used after.
+			if ( mModel != nullptr )
+				QMetaObject::invokeMethod( mModel, "onScanTaskFinished", Qt::QueuedConnection, Q_ARG( int, mScanId ) );
+
+		}
+
+		/**
+		  * Returns File-Path.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @throws - no exceptions.
+		**/
+		const QString & getPath( ) const noexcept
+		{ return( mPath ); }
+
+		/**
+		  * Returns parsing problems.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - ParseDiagnostics.
+		  * @throws - no exceptions.
+		**/
+		const ParseDiagnostics & getDiagnostics( ) const noexcept
+		{ return( mDiagnostics ); }
+
+		/**
+		  * Returns parsing statistics, merge counters set by ChannelModel.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - ParseStats.
+		  * @throws - no exceptions.
+		**/
+		ParseStats & getStats( ) noexcept
+		{ return( mStats ); }
+
+		/**
+		  * Returns fingerprint of File bytes.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - fingerprint, 0 if File can't be read.
+		  * @throws - no exceptions.
+		**/
+		quint64 getFingerprint( ) const noexcept
+		{ return( mFingerprint ); }
+
+		/**
+		  * Returns hashes of Items, read from File.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - Items hashes, empty if Items not hashed.
+		  * @throws - no exceptions.
+		**/
+		const QSet<quint64> & getItemHashes( ) const noexcept
+		{ return( mItemHashes ); }
+
+		/**
+		  * Returns staging Channel & releases ownership.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - Channel, or null.
+		  * @throws - no exceptions.
+		**/
+		rss::Channel * takeChannel( ) noexcept
+		{
+
+			// Copy-pointer-value.
+			rss::Channel *const result_( mChannel );
+
+			// Reset Channel-pointer.
+			mChannel = nullptr;
+
+			// Return Channel.
+			return( result_ );
+
+		}
+
+		// -----------------------------------------------------------
+
+	}; /// ChannelModel::ParseTask
+
+	// ===========================================================
+	// CONSTANTS
+	// ===========================================================
+
+	constexpr int ChannelModel::WATCH_DEBOUNCE_INTERVAL;
+
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -65,7 +392,33 @@ namespace rss
 	ChannelModel::ChannelModel( QObject *const qParent ) noexcept
 		: QAbstractItemModel( qParent ),
 		  mChannelsMutex( ),
-		  mChannels( )
+		  mChannels( ),
+		  mFingerprints( ),
+		  mItemHashes( ),
+		  mParserEngine( ParserEngine::SAX_PARSER_ENGINE ),
+		  mParseLimits( ),
+		  mRecoveryMode( false ),
+		  mStripHtml( false ),
+		  mDiagnostics( ),
+		  mIncrementalHandler( nullptr ),
+		  mIncrementalReader( nullptr ),
+		  mIncrementalSource( nullptr ),
+		  mIncrementalStream( nullptr ),
+		  mIncrementalStarted( false ),
+		  mIncrementalItems( 0 ),
+		  mIncrementalBytes( 0 ),
+		  mIncrementalFile( nullptr ),
+		  mIncrementalStepQueued( false ),
+		  mWatchedDir( ),
+		  mWatcher( nullptr ),
+		  mWatchTimer( nullptr ),
+		  mWatchedFiles( ),
+		  mScanPool( nullptr ),
+		  mScanTasks( ),
+		  mScanPending( 0 ),
+		  mScanId( 0 ),
+		  mRescanQueued( false ),
+		  mReclaimQueued( false )
 	{
 	}
 
@@ -81,6 +434,15 @@ namespace rss
 	ChannelModel::~ChannelModel( ) noexcept
 	{
 
+		// Cancel incremental parsing.
+		releaseIncrementalParser( );
+
+		// Cancel reading of Files.
+		cancelScan( );
+
+		// Stop watching directory.
+		unwatchDirectory( );
+
 		// Delete Channels.
 		clearChannels( );
 
@@ -209,6 +571,22 @@ namespace rss
 		// Thread-Lock.
 		QMutexLocker uLock( &mChannelsMutex );
 
+		// Search Channel.
+		return( searchChannelByLink( pLink ) );
+
+	} /// ChannelModel::getChannelByLink
+
+	/**
+	  * Searches added Channel using Link Element as Key.
+	  *
+	  * @threadsafe - must be called only while thread-lock locked.
+	  * @param pLink - Link Element Value (Url).
+	  * @returns - Channel if found, null if not.
+	  * @throws - no exceptions.
+	**/
+	ChannelModel::channel_ptr_t ChannelModel::searchChannelByLink( const QUrl & pLink ) const noexcept
+	{
+
 		// Link Element.
 		rss::Link * link_( nullptr );
 
@@ -221,7 +599,7 @@ namespace rss
 
 #if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
 			// Link - required ELement of every Channel.
-			assert( link_ != nullptr && "ChannelModel::getChannelByLink - Link Element not found !" );
+			assert( link_ != nullptr && "ChannelModel::searchChannelByLink - Link Element not found !" );
 #else // !DEBUG
 			// Cancel, if Link not found.
 			if ( link_ == nullptr )
@@ -237,7 +615,7 @@ namespace rss
 		// Return null.
 		return( channel_ptr_t( nullptr ) );
 
-	} /// ChannelModel::getChannelByLink
+	} /// ChannelModel::searchChannelByLink
 
 	/**
 	  * Returns RSS Channel-class data (title, description, image, etc).
@@ -315,8 +693,8 @@ namespace rss
 				return( QVariant( ) );
 #endif // DEBUG
 
-			// Return Link URL
-			return( QVariant( desc->mData ) );
+			// Return Description.
+			return( QVariant( desc->getData( mStripHtml ) ) );
 
 		} /// Description [<description>]
 
@@ -509,8 +887,8 @@ namespace rss
 			if ( description == nullptr )
 				return( QVariant( ) );
 
-			// Return Description.
-			return( QVariant( description->mData ) );
+			// Return Description. Raw Text decoded on first access.
+			return( QVariant( description->getData( mStripHtml ) ) );
 
 		} /// [<description>] Description
 
@@ -569,6 +947,28 @@ namespace rss
 
 		} /// [<guid>] GUID
 
+		// ======================= Extensions =======================
+
+		// [<content:encoded>] Content
+		case rss::ChannelModel::Roles::RSS_CONTENT_ENCODED_ELEMENT_ROLE:
+			return( getExtensionData( pItem, TAG_CONTENT_ENCODED ) );
+
+		// [<dc:creator>] Creator
+		case rss::ChannelModel::Roles::RSS_DC_CREATOR_ELEMENT_ROLE:
+			return( getExtensionData( pItem, TAG_DC_CREATOR ) );
+
+		// [<dc:date>] Date
+		case rss::ChannelModel::Roles::RSS_DC_DATE_ELEMENT_ROLE:
+			return( getExtensionData( pItem, TAG_DC_DATE ) );
+
+		// [<media:thumbnail>] Thumbnail Url
+		case rss::ChannelModel::Roles::RSS_MEDIA_THUMBNAIL_ELEMENT_ROLE:
+			return( getExtensionData( pItem, TAG_MEDIA_THUMBNAIL ) );
+
+		// [<media:content>] Media Url
+		case rss::ChannelModel::Roles::RSS_MEDIA_CONTENT_ELEMENT_ROLE:
+			return( getExtensionData( pItem, TAG_MEDIA_CONTENT ) );
+
 		// Default
 		default:
 		{
@@ -582,6 +982,94 @@ namespace rss
 
 	} /// ChannelModel::getItemData
 
+	/**
+	  * Returns value of Item extension (<content:encoded>, <dc:creator>, etc).
+	  *
+	  * @threadsafe - must be called only while thread-lock locked.
+	  * @param pItem - RSS Item.
+	  * @param pTag - Extension Tag.
+	  * @return - QVariant with value, or invalid QVariant.
+	  * @throws - no exceptions.
+	**/
+	QVariant ChannelModel::getExtensionData( const rss::Item *const pItem, const RSSTag pTag ) noexcept
+	{
+
+		// Get value.
+		const QString value_( pItem->getExtension( pTag ) );
+
+		// Return value, or invalid QVariant if not set.
+		return( value_.isNull( ) ? QVariant( ) : QVariant( value_ ) );
+
+	} /// ChannelModel::getExtensionData
+
+	/**
+	  * Returns Channel's Item, loads it from RSS-file if only indexed.
+	  *
+	  * @threadsafe - thread-safe, Channel thread-locks used.
+	  * @param pChannel - RSS Channel-class.
+	  * @param pIndex - Item index.
+	  * @return - Item, or null if not found or File can't be read.
+	  * @throws - no exceptions.
+	**/
+	rss::Item * ChannelModel::loadItem( rss::Channel *const pChannel, const int pIndex ) noexcept
+	{
+
+		// Return Item, if loaded.
+		rss::Item *const item_( pChannel->getItem( pIndex ) );
+		if ( item_ != nullptr )
+			return( item_ );
+
+		// Search Item record.
+		rss::Channel::ItemRecord record_;
+		if ( !pChannel->getItemRecord( pIndex, record_ ) )
+			return( nullptr );
+
+		// Cancel, if File rewritten since indexed. Old offsets point to other bytes.
+		const QFileInfo fileInfo_( record_.mPath );
+		if ( fileInfo_.size( ) != record_.mFileSize || fileInfo_.lastModified( ).toMSecsSinceEpoch( ) != record_.mModified )
+			return( nullptr );
+
+		// Open File.
+		QFile rssFile( record_.mPath );
+		if ( !rssFile.open( QIODevice::ReadOnly ) )
+			return( nullptr );
+
+		// Map only Item bytes.
+		uchar *const mappedItem_( rssFile.map( record_.mOffset, record_.mLength ) );
+		if ( mappedItem_ == nullptr )
+			return( nullptr );
+
+		// Create SAXRSSHandler, continues from Item Parent-Element.
+		rss::SAXRSSHandler rssHandler( pChannel, nullptr );
+		rssHandler.beginItem( record_.mParentTag );
+
+		// Scan Item bytes, in Document charset.
+		rss::FastRSSScanner scanner_( &rssHandler );
+		const bool scanned_( scanner_.parse( reinterpret_cast<const char*>( mappedItem_ ), record_.mLength, record_.mCharset ) );
+
+		// Unmap File.
+		rssFile.unmap( mappedItem_ );
+
+		// Take Item.
+		rss::Item *const loadedItem_( rssHandler.takeItem( ) );
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "ChannelModel::loadItem#" << record_.mPath << " - offset=" << record_.mOffset << ", scanned=" << scanned_;
+#endif // DEBUG
+
+		// Cancel, if File changed since indexed.
+		if ( !scanned_ || loadedItem_ == nullptr )
+		{
+			delete loadedItem_;
+			return( nullptr );
+		}
+
+		// Set Item, replacing record.
+		return( pChannel->setLoadedItem( pIndex, loadedItem_ ) );
+
+	} /// ChannelModel::loadItem
+
 	/**
 	  * Called when Channel-class data created or updated.
 	  *
@@ -617,6 +1105,9 @@ namespace rss
 
 		} /// Search Channel using Link.
 
+		// Views can read Channel from now, Elements replaced by Header copies.
+		pChannel->publish( );
+
 		// Lock
 		if ( pLock )
 		{
@@ -636,9 +1127,90 @@ namespace rss
 
 	}
 
+	/**
+	  * Adds staging Channel, or merges it to added Channel with the same Link.
+	  * Merged staging Channel, or Channel without Link, deleted.
+	  *
+	  * @threadsafe - must be called only while thread-lock locked.
+	  * @param pChannel - staging Channel.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::mergeChannel( rss::Channel *const pChannel ) noexcept
+	{
+
+		// Get Link Element.
+		rss::Link *const newLink_( static_cast<rss::Link*>( pChannel->getElement( rss::ElementType::LINK ) ) );
+
+		// Drop Channel without Link, as SAXRSSHandler does.
+		if ( newLink_ == nullptr )
+		{
+			delete pChannel;
+			return;
+		}
+
+		// Get Channel with the same Link.
+		rss::Channel *const prevChannel_( searchChannelByLink( newLink_->mUrl ) );
+
+		// Add new Channel, Header built by parser published once.
+		if ( prevChannel_ == nullptr )
+		{
+			pChannel->publish( );
+			mChannels.push_back( pChannel );
+			return;
+		}
+
+		// Merge Channels (move Elements & Items from staging to added).
+		rss::Channel::merge( pChannel, prevChannel_ );
+
+		// Delete empty staging Channel.
+		delete pChannel;
+
+	} /// ChannelModel::mergeChannel
+
+	/**
+	  * Counts Items of all Channels.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - number of Items.
+	  * @throws - no exceptions.
+	**/
+	int ChannelModel::countItems( ) const noexcept
+	{
+
+		// Items count.
+		int result_( 0 );
+
+		// Sum Channels Items.
+		for( const rss::Channel *const channel_ : mChannels )
+			result_ += channel_->count( );
+
+		// Return Items count.
+		return( result_ );
+
+	} /// ChannelModel::countItems
+
+	/**
+	  * Adds staging Channel, or merges it to added Channel with the same Link.
+	  * Merged staging Channel, or Channel without Link, deleted.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @param pChannel - staging Channel.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::addStagingChannel( rss::Channel *const pChannel ) noexcept
+	{
+
+		// Thread-Lock
+		QMutexLocker uLock( &mChannelsMutex );
+
+		// Add or merge Channel.
+		mergeChannel( pChannel );
+
+	} /// ChannelModel::addStagingChannel
+
 	/**
 	  * Called after RSS parsing complete.
-	  * Cause attach Views to Update.
+	  * Cause attach Views to Update. #itemsChanged emitted, if Channels Items rows changed.
 	  *
 	  * @threadsafe - not thread-safe.
 	  * @throws - no exceptions.
@@ -654,8 +1226,60 @@ namespace rss
 		beginInsertRows( QModelIndex( ), 0, mChannels.size( ) - 1 );
 		endInsertRows( );
 
+		// Check changed Items rows. Each Channel flag reset.
+		bool itemsChanged_( false );
+		mChannelsMutex.lock( );
+		for( const channel_ptr_t channel_ : mChannels )
+			itemsChanged_ = channel_->takeItemsChanged( ) || itemsChanged_;
+		mChannelsMutex.unlock( );
+
+		// Views read Items rows again.
+		if ( itemsChanged_ )
+			emit itemsChanged( );
+
+		// Delete replaced Elements & Items, when Views finished this event-loop turn.
+		if ( !mReclaimQueued )
+		{
+			mReclaimQueued = true;
+			QTimer::singleShot( 0, this, &ChannelModel::reclaimChannels );
+		}
+
 	}
 
+	/**
+	  * Deletes Elements & Items, replaced in Channels by parsing.
+	  * Queued by #onChannelsUpdated, so runs when Views don't use them (safe point).
+	  * Views keeping Items notified by #itemsRetired first.
+	  *
+	  * @threadsafe - not thread-safe, called only by GUI-thread.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::reclaimChannels( ) noexcept
+	{
+
+		// Reset
+		mReclaimQueued = false;
+
+		// Check retired Items.
+		bool retiredItems_( false );
+		mChannelsMutex.lock( );
+		for( const channel_ptr_t channel_ : mChannels )
+			retiredItems_ = retiredItems_ || channel_->hasRetiredItems( );
+		mChannelsMutex.unlock( );
+
+		// Views drop retired Items.
+		if ( retiredItems_ )
+			emit itemsRetired( );
+
+		// Thread-Lock
+		QMutexLocker uLock( &mChannelsMutex );
+
+		// Reclaim Channels.
+		for( channel_ptr_t channel_ : mChannels )
+			channel_->reclaim( );
+
+	} /// ChannelModel::reclaimChannels
+
 	/**
 	  * Deletes all Channels.
 	  *
@@ -683,96 +1307,1305 @@ namespace rss
 		// Clear Channels Collection (container, map).
 		mChannels.clear( );
 
+		// Files read again.
+		mFingerprints.clear( );
+		mItemHashes.clear( );
+
 	}
 
 	/**
-	  * Reads RSS-file.
+	  * Parses RSS-file.
 	  *
-	  * (?) If RSS-Channel with the same link found,
-	  * and it's newer (pubDate, lastBuildDate), their data merged.
+	  * (?) File memory-mapped if possible, parsers read mapped pages through QBuffer.
+	  * Compressed Files (gzip, zlib, raw deflate) inflated while parsed, with SAX or pull-parser.
+	  * Parsing stops, when any of Handler limits reached.
 	  *
-	  * @threadsafe - not thread-safe.
-	  * @param pSrc - File-Path.
-	  * @param pChannel - Channel-class to update from rss-document.
+	  * Fingerprint (xxHash64) computed over mapped bytes, so File read once.
+	  * File with the same fingerprint not parsed (ParseStats#mUnchanged).
+	  *
+	  * @threadsafe - thread-safe, if Handler is not shared.
+	  * @param pFile - File to read.
+	  * @param pHandler - RSS Handler.
+	  * @param pEngine - ParserEngine.
+	  * @param pPrevFingerprint - fingerprint of File bytes, when File read last time. 0 if not read.
+	  * @param pFingerprint - fingerprint of File bytes, 0 if File not mapped whole.
+	  * @return - 'true' if document parsed or unchanged, 'false' if error or limit reached.
 	  * @throws - no exceptions.
 	**/
-	void ChannelModel::readFile( const QString & pSrc, rss::Channel *const pChannel ) noexcept
+	bool ChannelModel::parseFile( QFile & pFile, rss::SAXRSSHandler & pHandler, const int pEngine, const quint64 pPrevFingerprint, quint64 & pFingerprint ) noexcept
 	{
 
-		// Create SAXRSSHandler instance.
-		rss::SAXRSSHandler rssHandler( pChannel, this );
+		// Statistics, Elements & Items counted by Handler.
+		ParseStats & stats_( pHandler.getStats( ) );
+		stats_.mPath = pFile.fileName( );
+		stats_.mEngine = pEngine;
 
-		// Create QFile.
-		QFile rssFile( pSrc );
+		// Reset
+		pFingerprint = 0;
 
-#if defined( QT_DEBUG ) // DEBUG
-		// Debug
-		qDebug( ) << "ChannelModel::readFile#" << pSrc;
+		// Allocated Elements & Arena blocks before parsing.
+		const qint64 allocations_( rss::Element::countAllocations( ) );
+		const qint64 arenaBlocks_( rss::ElementArena::countBlocks( ) );
+		const qint64 arenaReserved_( rss::ElementArena::countReservedBytes( ) );
+		const qint64 arenaUsed_( rss::ElementArena::countUsedBytes( ) );
 
-		// Check FileExistance
-		assert( rssFile.exists( ) && "ChannelModel::readFile - file not found !" );
-#else // !DEBUG
-		if ( !rssFile.exists( ) )
-			return;
-#endif // DEBUG
+		// Phases Timer.
+		QElapsedTimer phaseTimer_;
+		phaseTimer_.start( );
 
-		// Create Xml-InputSource
-		QXmlInputSource inputSource( &rssFile );
+		// Open File.
+		if ( !pFile.open( QIODevice::ReadOnly ) )
+			return( false );
 
-		// Create default Xml-Reader.
-		QXmlSimpleReader xmlReader;
+		// Parsing Limits.
+		const ParseLimits & limits_( pHandler.getLimits( ) );
 
-		// Set SAX-Handler for Xml-Reader.
-		xmlReader.setContentHandler( &rssHandler );
+		// File Size.
+		const qint64 fileSize_( pFile.size( ) );
 
-		// Parse SAX Xml RSS-Document.
-		xmlReader.parse( &inputSource );
+		// Compressed File Format.
+		const rss::GzipDevice::Format compression_( rss::GzipDevice::detectFormat( pFile, pFile.fileName( ) ) );
 
-		// Update
-		onChannelsUpdated( );
+		// Number of bytes to parse. Bytes after size limit ignored.
+		const qint64 inputSize_( limits_.mMaxBytes > 0 && compression_ == rss::GzipDevice::NONE_FORMAT ? qMin( fileSize_, limits_.mMaxBytes ) : fileSize_ );
 
-	} /// ChannelModel::readFile
+		// Map File, parsers read mapped pages without copying whole File to memory. Compressed Files mapped whole, inflated from mapped pages.
+		uchar *const mappedBytes_( inputSize_ > 0 && inputSize_ <= std::numeric_limits<int>::max( ) ? pFile.map( 0, inputSize_ ) : nullptr );
 
-	/**
-	  * Read RSS-file using QUrl.
-	  *
-	  * @threadsafe - thread-lock used, only if required.
-	  * @param pUrl - URL from QML.
-	  * @throws - no exceptions.
-	**/
-	void ChannelModel::parseRSSFile( const QUrl pUrl ) noexcept
-	{ readFile( pUrl.toLocalFile( ), nullptr ); }
+		// Mapped Document bytes, null if compressed.
+		uchar *const mappedFile_( compression_ == rss::GzipDevice::NONE_FORMAT ? mappedBytes_ : nullptr );
 
-	// ===========================================================
-	// OVERRIDE
-	// ===========================================================
+		// Stop, if File over size limit can't be mapped (read whole otherwise).
+		if ( mappedBytes_ == nullptr && inputSize_ < fileSize_ )
+			return( pHandler.onLimitReached( ParseLimits::BYTES_LIMIT ) );
 
-	Qt::ItemFlags ChannelModel::flags( const QModelIndex & pIndex ) const
-	{
+		// Fingerprint of mapped File bytes, the same bytes parsed.
+		if ( mappedBytes_ != nullptr && inputSize_ == fileSize_ )
+			pFingerprint = XXHash64::hash( mappedBytes_, static_cast<size_t>( fileSize_ ) );
 
-#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
-		// Debug
-		qDebug( ) << "ChannelModel::flags, index.row=" << pIndex.row( ) << "index.col=" << pIndex.column( ) << "index.pointer=" << QString( pIndex.internalPointer( ) != nullptr );
-#endif // DEBUG
+		// Skip File with the same bytes, all it's Items already added.
+		if ( pFingerprint != 0 && pFingerprint == pPrevFingerprint )
+		{
 
-		// Return
-		return( Qt::ItemFlags( Qt::ItemFlag::ItemIsEnabled | Qt::ItemFlag::ItemIsSelectable ) );
+			// Unmap File.
+			pFile.unmap( mappedBytes_ );
 
-	}
+			// Unchanged
+			stats_.mParsed = true;
+			stats_.mUnchanged = true;
+			stats_.mReadTime = phaseTimer_.nsecsElapsed( );
 
-	/**
-	  * Extract specific data using index.
-	  *
-	  * @threadsafe - thread-lock used.
-	  * @param pIndex - Model-Index, contains inner-data (RSS Channel || Item).
-	  * @param pRole - Model-Item Role, default is DisplayRole (Text).
-	  * @return - QVariant with data.
-	  * @throws - no exceptions.
-	**/
-	QVariant ChannelModel::data( const QModelIndex & pIndex, int pRole ) const
-	{
+			// Return TRUE
+			return( true );
 
-#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		} /// Skip File with the same bytes.
+
+		// Mapped File bytes, not copied.
+		QByteArray mappedData_;
+
+		// Device over mapped File bytes.
+		QBuffer mappedBuffer_;
+
+		// Use mapped File.
+		if ( mappedBytes_ != nullptr )
+		{
+
+			// Wrap mapped pages.
+			mappedData_ = QByteArray::fromRawData( reinterpret_cast<const char*>( mappedBytes_ ), static_cast<int>( inputSize_ ) );
+
+			// Open Buffer.
+			mappedBuffer_.setBuffer( &mappedData_ );
+			mappedBuffer_.open( QIODevice::ReadOnly );
+
+		} /// Use mapped File.
+
+		// Inflating Device, reads compressed File (mapped pages, if mapped) by chunks.
+		rss::GzipDevice gzipDevice_( mappedBytes_ != nullptr ? static_cast<QIODevice*>( &mappedBuffer_ ) : &pFile, compression_ );
+		gzipDevice_.setSizeLimit( limits_.mMaxBytes );
+		if ( compression_ != rss::GzipDevice::NONE_FORMAT && !gzipDevice_.open( QIODevice::ReadOnly ) )
+		{
+			if ( mappedBytes_ != nullptr )
+			{
+				mappedBuffer_.close( );
+				pFile.unmap( mappedBytes_ );
+			}
+			return( false );
+		}
+
+		// Input Device. If File can't be mapped, read it directly. Compressed File inflated.
+		QIODevice * inputDevice_( &pFile );
+		if ( compression_ != rss::GzipDevice::NONE_FORMAT )
+			inputDevice_ = &gzipDevice_;
+		else if ( mappedFile_ != nullptr )
+			inputDevice_ = &mappedBuffer_;
+
+		// Read phase done (open, detect, map).
+		stats_.mReadTime = phaseTimer_.nsecsElapsed( );
+		phaseTimer_.restart( );
+
+		// Result
+		bool result_( false );
+
+		// 'true' if File parsed by fast Scanner, whole or until limit reached.
+		bool scanned_( false );
+
+		// Fast Scanner, mapped Files only. Used by recovery mode with any Engine, only Scanner continues after malformed Item.
+		if ( ( pEngine == ParserEngine::FAST_PARSER_ENGINE || pEngine == ParserEngine::LAZY_PARSER_ENGINE || pHandler.recovers( ) ) && mappedFile_ != nullptr )
+		{
+
+			// Staging Handler, discarded if Scanner gives up.
+			rss::SAXRSSHandler scanHandler_( nullptr, nullptr );
+			scanHandler_.setLimits( limits_ );
+			scanHandler_.setRecovery( pHandler.recovers( ) );
+			scanHandler_.setUseArena( pHandler.usesArena( ) );
+
+			// Only index Items, they are loaded by #loadItem.
+			if ( pEngine == ParserEngine::LAZY_PARSER_ENGINE )
+				scanHandler_.setItemsIndex( pFile.fileName( ), fileSize_, QFileInfo( pFile.fileName( ) ).lastModified( ).toMSecsSinceEpoch( ) );
+
+			// Skip Items, read from this File before.
+			if ( pHandler.hashesItems( ) )
+				scanHandler_.setKnownItems( pHandler.getKnownItems( ) );
+
+			// Create Scanner.
+			rss::FastRSSScanner scanner_( &scanHandler_ );
+
+			// Scan mapped bytes.
+			result_ = scanner_.parse( reinterpret_cast<const char*>( mappedFile_ ), inputSize_ );
+
+			// Limit reached, Items accepted so far kept.
+			const ParseLimits::LimitType scanLimit_( scanHandler_.getExceededLimit( ) );
+			scanned_ = result_ || scanLimit_ != ParseLimits::NO_LIMIT;
+
+			// Pass Channel to Handler.
+			if ( scanned_ )
+			{
+
+				// Scanning done.
+				stats_.mParseTime = phaseTimer_.nsecsElapsed( );
+				phaseTimer_.restart( );
+
+				// Pass counters.
+				stats_.mElements = scanHandler_.getStats( ).mElements;
+				stats_.mItemsCreated = scanHandler_.getStats( ).mItemsCreated;
+				stats_.mItemsSkipped = scanHandler_.getStats( ).mItemsSkipped;
+
+				// Pass Items hashes.
+				pHandler.getItemHashes( ).swap( scanHandler_.getItemHashes( ) );
+
+				// Pass reached limit.
+				if ( scanLimit_ != ParseLimits::NO_LIMIT )
+					pHandler.onLimitReached( scanLimit_ );
+
+				// Pass Channel & recovered Regions.
+				pHandler.adoptChannel( scanHandler_.getChannel( ) );
+				pHandler.setDiagnostics( scanHandler_.getDiagnostics( ) );
+
+				// Merging done.
+				stats_.mMergeTime = phaseTimer_.nsecsElapsed( );
+
+			} /// Pass Channel to Handler.
+			else
+				delete scanHandler_.getChannel( ); // Discard partial Channel.
+
+		} /// Fast Scanner
+
+		// Pull-Parser
+		if ( !scanned_ && pEngine == ParserEngine::STREAM_PARSER_ENGINE )
+		{
+
+			// Create Pull-Parser.
+			rss::StreamRSSReader streamReader( &pHandler );
+
+			// Parse Xml RSS-Document.
+			result_ = streamReader.parse( inputDevice_ );
+
+		} /// Pull-Parser
+		else if ( !scanned_ )
+		{ // SAX, fallback of fast Scanner
+
+			// Create Xml-InputSource
+			QXmlInputSource inputSource( inputDevice_ );
+
+			// Create default Xml-Reader.
+			QXmlSimpleReader xmlReader;
+
+			// Set SAX-Handler for Xml-Reader.
+			xmlReader.setContentHandler( &pHandler );
+			xmlReader.setErrorHandler( &pHandler );
+
+			// Parse SAX Xml RSS-Document.
+			result_ = xmlReader.parse( &inputSource );
+
+		} /// SAX
+
+		// Parsing done. Items merged while parsed, so merge time included.
+		if ( !scanned_ )
+			stats_.mParseTime = phaseTimer_.nsecsElapsed( );
+
+		// Bytes read (inflated, if compressed).
+		stats_.mBytesRead = mappedFile_ != nullptr ? inputSize_ : inputDevice_->pos( );
+
+		// Document truncated by size limit. Truncated tail can be dropped in recovery mode, so result not checked.
+		if ( inputSize_ < fileSize_ || gzipDevice_.isSizeLimitReached( ) )
+			pHandler.onLimitReached( ParseLimits::BYTES_LIMIT );
+
+		// Unmap File.
+		if ( mappedBytes_ != nullptr )
+		{
+			gzipDevice_.close( );
+			mappedBuffer_.close( );
+			pFile.unmap( mappedBytes_ );
+		}
+
+		// Result & allocations.
+		stats_.mParsed = result_;
+		stats_.mExceededLimit = pHandler.getExceededLimit( );
+		stats_.mAllocations = rss::Element::countAllocations( ) - allocations_;
+		stats_.mArenaBlocks = rss::ElementArena::countBlocks( ) - arenaBlocks_;
+		stats_.mArenaReserved = rss::ElementArena::countReservedBytes( ) - arenaReserved_;
+		stats_.mArenaUsed = rss::ElementArena::countUsedBytes( ) - arenaUsed_;
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "ChannelModel::parseFile#" << pFile.fileName( ) << " - engine=" << pEngine << ", mapped=" << ( mappedFile_ != nullptr ) << ", compression=" << compression_ << ", scanned=" << scanned_ << ", parsed in " << ( stats_.mReadTime + stats_.mParseTime + stats_.mMergeTime ) << "ns";
+#endif // DEBUG
+
+		// Return result.
+		return( result_ );
+
+	} /// ChannelModel::parseFile
+
+	/**
+	  * Reads RSS-file.
+	  *
+	  * (?) If RSS-Channel with the same link found,
+	  * and it's newer (pubDate, lastBuildDate), their data merged.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pSrc - File-Path.
+	  * @param pChannel - Channel-class to update from rss-document.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::readFile( const QString & pSrc, rss::Channel *const pChannel ) noexcept
+	{
+
+		// Create SAXRSSHandler instance.
+		rss::SAXRSSHandler rssHandler( pChannel, this );
+
+		// Set Limits & recovery mode.
+		rssHandler.setLimits( mParseLimits );
+		rssHandler.setRecovery( mRecoveryMode );
+
+		// Skip Items, read from this File before.
+		rssHandler.setKnownItems( mItemHashes.value( pSrc ) );
+
+		// Channel Arena used only when File read first time, updates use Elements pools.
+		rssHandler.setUseArena( !mFingerprints.contains( pSrc ) );
+
+		// Create QFile.
+		QFile rssFile( pSrc );
+
+#if defined( QT_DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "ChannelModel::readFile#" << pSrc;
+
+		// Check FileExistance
+		assert( rssFile.exists( ) && "ChannelModel::readFile - file not found !" );
+#else // !DEBUG
+		if ( !rssFile.exists( ) )
+			return;
+#endif // DEBUG
+
+		// Statistics.
+		ParseStats & stats_( rssHandler.getStats( ) );
+
+		// Items before parsing.
+		const int itemsCount_( countItems( ) );
+
+		// Fingerprint of File bytes.
+		quint64 fingerprint_( 0 );
+
+		// Parse File. File with the same bytes skipped, all it's Items already added.
+		parseFile( rssFile, rssHandler, mParserEngine, mFingerprints.value( pSrc, 0 ), fingerprint_ );
+
+		// Notify
+		if ( stats_.mUnchanged )
+		{
+			emit parseFinished( stats_ );
+			return;
+		}
+
+		// Keep problems & fingerprint.
+		setDiagnostics( pSrc, rssHandler.getDiagnostics( ) );
+		setFingerprint( stats_, fingerprint_, rssHandler.getItemHashes( ) );
+
+		// Count merged & rejected (duplicate, dropped) Items.
+		stats_.mItemsMerged = countItems( ) - itemsCount_;
+		stats_.mItemsRejected = qMax( stats_.mItemsCreated - stats_.mItemsMerged, 0 );
+
+		// Update
+		onChannelsUpdated( );
+
+		// Notify
+		emit parseFinished( stats_ );
+
+	} /// ChannelModel::readFile
+
+	/**
+	  * Returns Xml Parser Engine used to read RSS-documents.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - ParserEngine.
+	  * @throws - no exceptions.
+	**/
+	int ChannelModel::getParserEngine( ) const noexcept
+	{ return( mParserEngine ); }
+
+	/**
+	  * Sets Xml Parser Engine used to read RSS-documents.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pEngine - ParserEngine.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::setParserEngine( const int pEngine ) noexcept
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Check Engine.
+		assert( ( pEngine == ParserEngine::SAX_PARSER_ENGINE || pEngine == ParserEngine::STREAM_PARSER_ENGINE || pEngine == ParserEngine::FAST_PARSER_ENGINE || pEngine == ParserEngine::LAZY_PARSER_ENGINE ) && "ChannelModel::setParserEngine - unknown Parser Engine !" );
+#endif // DEBUG
+
+		// Set Engine.
+		mParserEngine = pEngine;
+
+	} /// ChannelModel::setParserEngine
+
+	/**
+	  * Returns limits of one RSS-document parsing.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - ParseLimits.
+	  * @throws - no exceptions.
+	**/
+	const ParseLimits & ChannelModel::getParseLimits( ) const noexcept
+	{ return( mParseLimits ); }
+
+	/**
+	  * Sets limits of one RSS-document parsing.
+	  * Items accepted before limit reached are kept.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pLimits - ParseLimits, 0 means no limit.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::setParseLimits( const ParseLimits & pLimits ) noexcept
+	{ mParseLimits = pLimits; }
+
+	/**
+	  * Returns 'true' if recovery mode enabled.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool ChannelModel::getRecoveryMode( ) const noexcept
+	{ return( mRecoveryMode ); }
+
+	/**
+	  * Enables recovery mode: malformed Item dropped, parsing
+	  * continues from the next Item, so well-formed Items kept.
+	  *
+	  * (?) Recovery done by fast Scanner, so used for mapped Files by any ParserEngine.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pRecovery - 'true' to recover.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::setRecoveryMode( const bool pRecovery ) noexcept
+	{ mRecoveryMode = pRecovery; }
+
+	/**
+	  * Returns 'true' if HTML removed from Descriptions.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool ChannelModel::getStripHtml( ) const noexcept
+	{ return( mStripHtml ); }
+
+	/**
+	  * Enables removing of HTML tags & entities from Descriptions.
+	  * Stripped Text cached with decoded Descriptions.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pStrip - 'true' to show plain Text.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::setStripHtml( const bool pStrip ) noexcept
+	{
+
+		// Cancel, if not changed.
+		if ( mStripHtml == pStrip )
+			return;
+
+		// Set
+		mStripHtml = pStrip;
+
+		// Update Views.
+		onChannelsUpdated( );
+
+	} /// ChannelModel::setStripHtml
+
+	/**
+	  * Returns problems of last File parsing.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pPath - File-Path.
+	  * @return - ParseDiagnostics, empty if File parsed without problems.
+	  * @throws - no exceptions.
+	**/
+	ParseDiagnostics ChannelModel::getDiagnostics( const QString & pPath ) const noexcept
+	{ return( mDiagnostics.value( pPath ) ); }
+
+	/**
+	  * Returns statistics of Texts pool, used by lazy-loaded Items & updated Files.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @return - PoolStats.
+	  * @throws - no exceptions.
+	**/
+	rss::PoolStats ChannelModel::getTextPoolStats( ) const noexcept
+	{ return( rss::ElementPool<rss::Text>::getStats( ) ); }
+
+	/**
+	  * Returns statistics of Links pool, used by lazy-loaded Items & updated Files.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @return - PoolStats.
+	  * @throws - no exceptions.
+	**/
+	rss::PoolStats ChannelModel::getLinkPoolStats( ) const noexcept
+	{ return( rss::ElementPool<rss::Link>::getStats( ) ); }
+
+	/**
+	  * Returns statistics of Dates pool, used by lazy-loaded Items & updated Files.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @return - PoolStats.
+	  * @throws - no exceptions.
+	**/
+	rss::PoolStats ChannelModel::getDatePoolStats( ) const noexcept
+	{ return( rss::ElementPool<rss::Date>::getStats( ) ); }
+
+	/**
+	  * Stores problems of parsed File.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pPath - File-Path.
+	  * @param pDiagnostics - ParseDiagnostics.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::setDiagnostics( const QString & pPath, const ParseDiagnostics & pDiagnostics ) noexcept
+	{
+
+		// Forget problems of previous parsing.
+		if ( pDiagnostics.isEmpty( ) )
+			mDiagnostics.remove( pPath );
+		else
+			mDiagnostics.insert( pPath, pDiagnostics );
+
+	} /// ChannelModel::setDiagnostics
+
+	/**
+	  * Read RSS-file using QUrl.
+	  *
+	  * @threadsafe - thread-lock used, only if required.
+	  * @param pUrl - URL from QML.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::parseRSSFile( const QUrl pUrl ) noexcept
+	{ readFile( pUrl.toLocalFile( ), nullptr ); }
+
+	/**
+	  * Adds (merges) staging Channels of finished Tasks under one thread-lock,
+	  * keeps problems & fingerprints, then Views notified once.
+	  * Tasks deleted.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @param pTasks - finished Tasks.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::mergeParseTasks( const QVector<ParseTask*> & pTasks ) noexcept
+	{
+
+		// Merge staging Channels under one thread-lock.
+		{
+
+			// Thread-Lock.
+			QMutexLocker uLock( &mChannelsMutex );
+
+			// Merge Timer.
+			QElapsedTimer mergeTimer_;
+			mergeTimer_.start( );
+
+			// Merge Channels.
+			for( ParseTask *const task_ : pTasks )
+			{
+
+				// Get staging Channel.
+				rss::Channel *const channel_( task_->takeChannel( ) );
+
+				// Statistics.
+				ParseStats & stats_( task_->getStats( ) );
+
+				// Add or merge Channel.
+				if ( channel_ != nullptr )
+				{
+
+					// Items & time before merge.
+					const int itemsCount_( countItems( ) );
+					mergeTimer_.restart( );
+
+					// Merge
+					mergeChannel( channel_ );
+
+					// Count merged Items.
+					stats_.mMergeTime = mergeTimer_.nsecsElapsed( );
+					stats_.mItemsMerged = countItems( ) - itemsCount_;
+
+				} /// Add or merge Channel.
+
+				// Count rejected Items.
+				stats_.mItemsRejected = qMax( stats_.mItemsCreated - stats_.mItemsMerged, 0 );
+
+			} /// Merge Channels.
+
+		} /// Merge staging Channels under one thread-lock.
+
+		// Keep problems & fingerprints.
+		for( ParseTask *const task_ : pTasks )
+		{
+
+			// Unchanged File keeps problems of previous reading.
+			if ( task_->getStats( ).mUnchanged )
+				continue;
+
+			// Keep
+			setDiagnostics( task_->getPath( ), task_->getDiagnostics( ) );
+			setFingerprint( task_->getStats( ), task_->getFingerprint( ), task_->getItemHashes( ) );
+
+		} /// Keep problems & fingerprints.
+
+		// Update once.
+		onChannelsUpdated( );
+
+		// Notify & delete Tasks.
+		for( ParseTask *const task_ : pTasks )
+		{
+			emit parseFinished( task_->getStats( ) );
+			delete task_;
+		}
+
+	} /// ChannelModel::mergeParseTasks
+
+	/**
+	  * Read RSS-files in parallel.
+	  *
+	  * (?) Each File parsed on a thread-pool to own staging Channel.
+	  * GUI-thread not blocked, staging Channels added (merged)
+	  * under one thread-lock by #onScanTaskFinished, then Views notified once.
+	  * Files, opened while other Files read, merged with them.
+	  *
+	  * @threadsafe - not thread-safe, called only by GUI-thread.
+	  * @param pUrls - Files URLs.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::parseRSSFiles( const QList<QUrl> & pUrls ) noexcept
+	{
+
+		// Cancel, if no Files.
+		if ( pUrls.isEmpty( ) )
+			return;
+
+		// Read Files in parallel. Channels merged by #onScanTaskFinished.
+		startParseTasks( pUrls );
+
+	} /// ChannelModel::parseRSSFiles
+
+	/**
+	  * Reads all RSS-files of directory & watches it.
+	  * New & changed Files read again (in parallel) after burst of writes ends,
+	  * their Channels merged with added Channels.
+	  * Previous watched directory replaced.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pPath - directory path.
+	  * @return - 'true' if watched, 'false' if directory not found.
+	  * @throws - no exceptions.
+	**/
+	bool ChannelModel::watchDirectory( const QString & pPath ) noexcept
+	{
+
+		// Stop watching previous directory.
+		unwatchDirectory( );
+
+		// Cancel, if directory not found.
+		const QDir dir_( pPath );
+		if ( pPath.isEmpty( ) || !dir_.exists( ) )
+			return( false );
+
+		// Set directory.
+		mWatchedDir = dir_.absolutePath( );
+
+		// Create Watcher.
+		mWatcher = new QFileSystemWatcher( this );
+		mWatcher->addPath( mWatchedDir );
+		connect( mWatcher, &QFileSystemWatcher::directoryChanged, this, &ChannelModel::onWatchedPathChanged );
+		connect( mWatcher, &QFileSystemWatcher::fileChanged, this, &ChannelModel::onWatchedPathChanged );
+
+		// Create debounce Timer.
+		mWatchTimer = new QTimer( this );
+		mWatchTimer->setSingleShot( true );
+		mWatchTimer->setInterval( WATCH_DEBOUNCE_INTERVAL );
+		connect( mWatchTimer, &QTimer::timeout, this, &ChannelModel::scanWatchedDirectory );
+
+		// Read Files.
+		scanWatchedDirectory( );
+
+		// Return TRUE
+		return( true );
+
+	} /// ChannelModel::watchDirectory
+
+	/**
+	  * Stops watching directory. Read Channels kept, Files read now still merged.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::unwatchDirectory( ) noexcept
+	{
+
+		// Files, read now, still merged (may be opened by user). Rescan dropped.
+		mRescanQueued = false;
+
+		// Delete Watcher & Timer.
+		delete mWatcher;
+		mWatcher = nullptr;
+		delete mWatchTimer;
+		mWatchTimer = nullptr;
+
+		// Reset directory.
+		mWatchedDir.clear( );
+		mWatchedFiles.clear( );
+
+	} /// ChannelModel::unwatchDirectory
+
+	/**
+	  * Called when watched directory, or its File, changed.
+	  * Restarts debounce timer, so burst of writes read once.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pPath - changed path.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::onWatchedPathChanged( const QString & pPath ) noexcept
+	{
+
+#if defined( QT_DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "ChannelModel::onWatchedPathChanged#" << pPath;
+#else // !DEBUG
+		Q_UNUSED( pPath );
+#endif // DEBUG
+
+		// Restart Timer.
+		if ( mWatchTimer != nullptr )
+			mWatchTimer->start( );
+
+	} /// ChannelModel::onWatchedPathChanged
+
+	/**
+	  * Reads new & changed Files of watched directory.
+	  * File read again, only if it's size or modification time, & content fingerprint changed.
+	  * Files read on thread-pool, so GUI-thread not blocked. Channels merged by #onScanTaskFinished.
+	  * Reading, requested while previous not merged, queued.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::scanWatchedDirectory( ) noexcept
+	{
+
+		// Cancel, if not watched.
+		if ( mWatcher == nullptr )
+			return;
+
+		// Read again, when Files of previous reading merged.
+		if ( !mScanTasks.isEmpty( ) )
+		{
+			mRescanQueued = true;
+			return;
+		}
+
+		// Files of directory.
+		const QFileInfoList entries_( QDir( mWatchedDir ).entryInfoList( QDir::Files | QDir::Readable, QDir::Name ) );
+
+		// States of current Files. Removed Files dropped.
+		QMap<QString, WatchedFile> files_;
+
+		// Changed Files.
+		QList<QUrl> changed_;
+
+		// Compare Files.
+		for( const QFileInfo & entry_ : entries_ )
+		{
+
+			// File-Path.
+			const QString path_( entry_.absoluteFilePath( ) );
+
+			// Size & modification time.
+			const WatchedFile state_{ entry_.size( ), entry_.lastModified( ).toMSecsSinceEpoch( ) };
+
+			// Previous state.
+			const auto prevState_( mWatchedFiles.constFind( path_ ) );
+
+			// Keep state.
+			files_.insert( path_, state_ );
+
+			// Read new or changed File. File rewritten with the same bytes skipped by fingerprint.
+			if ( prevState_ == mWatchedFiles.constEnd( ) || prevState_->mSize != state_.mSize || prevState_->mModified != state_.mModified )
+				changed_.push_back( QUrl::fromLocalFile( path_ ) );
+
+		} /// Compare Files.
+
+		// Keep states.
+		mWatchedFiles = files_;
+
+		// Watch Files, written in place. Replaced (renamed) Files aren't watched anymore, so added again.
+		const QStringList watchedFiles_( mWatcher->files( ) );
+		for( const QString & path_ : watchedFiles_ )
+		{
+			if ( !files_.contains( path_ ) )
+				mWatcher->removePath( path_ );
+		}
+		for( auto file_ = files_.constBegin( ); file_ != files_.constEnd( ); ++file_ )
+		{
+			if ( !watchedFiles_.contains( file_.key( ) ) )
+				mWatcher->addPath( file_.key( ) );
+		}
+
+#if defined( QT_DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "ChannelModel::scanWatchedDirectory#" << mWatchedDir << " - files=" << files_.size( ) << ", changed=" << changed_.size( );
+#endif // DEBUG
+
+		// Cancel, if no changed Files.
+		if ( changed_.isEmpty( ) )
+			return;
+
+		// Read changed Files in parallel. Channels merged by #onScanTaskFinished.
+		startParseTasks( changed_ );
+
+	} /// ChannelModel::scanWatchedDirectory
+
+	/**
+	  * Starts Tasks, reading Files on thread-pool.
+	  * Tasks added to running reading (#mScanTasks), if any, so all merged once.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pUrls - Files URLs.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::startParseTasks( const QList<QUrl> & pUrls ) noexcept
+	{
+
+		// Create Thread-Pool, one thread per core.
+		if ( mScanPool == nullptr )
+		{
+			mScanPool = new QThreadPool( this );
+			mScanPool->setMaxThreadCount( QThread::idealThreadCount( ) );
+		}
+
+		// New reading, if no Files read now.
+		if ( mScanTasks.isEmpty( ) )
+		{
+			mScanId++;
+			mScanPending = 0;
+		}
+
+		// Create & start Tasks.
+		mScanTasks.reserve( mScanTasks.size( ) + pUrls.size( ) );
+		for( const QUrl & url_ : pUrls )
+		{
+
+			// Create Task.
+			const QString path_( url_.toLocalFile( ) );
+			ParseTask *const task_( new ParseTask( path_, mParserEngine, mParseLimits, mRecoveryMode, mFingerprints.value( path_, 0 ), mItemHashes.value( path_ ), this, mScanId ) );
+			mScanTasks.push_back( task_ );
+			mScanPending++;
+
+			// Start Task.
+			mScanPool->start( task_ );
+
+		} /// Create & start Tasks.
+
+	} /// ChannelModel::startParseTasks
+
+	/**
+	  * Called by ParseTask of Files reading (opened, or of watched directory), when it's File parsed.
+	  * When all Tasks finished, their staging Channels merged & Views notified once.
+	  *
+	  * (?) Queued to GUI-thread by worker thread.
+	  *
+	  * @threadsafe - not thread-safe, called only by GUI-thread.
+	  * @param pScanId - Id of Files reading (#mScanId).
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::onScanTaskFinished( const int pScanId ) noexcept
+	{
+
+		// Ignore Task of cancelled reading.
+		if ( pScanId != mScanId || mScanTasks.isEmpty( ) )
+			return;
+
+		// Wait for other Tasks.
+		if ( --mScanPending > 0 )
+			return;
+
+		// All Tasks notified, wait until they returned to Thread-Pool.
+		mScanPool->waitForDone( );
+
+		// Take Tasks.
+		QVector<ParseTask*> tasks_;
+		tasks_.swap( mScanTasks );
+
+		// Merge Channels & notify.
+		mergeParseTasks( tasks_ );
+
+		// Read watched Files, changed while previous Files read.
+		if ( mRescanQueued )
+		{
+			mRescanQueued = false;
+			scanWatchedDirectory( );
+		}
+
+	} /// ChannelModel::onScanTaskFinished
+
+	/**
+	  * Cancels Files reading. Waits for running Tasks,
+	  * deletes Tasks & their staging Channels.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::cancelScan( ) noexcept
+	{
+
+		// Wait for running Tasks.
+		if ( mScanPool != nullptr )
+			mScanPool->waitForDone( );
+
+		// Delete Tasks & their staging Channels.
+		for( ParseTask *const task_ : mScanTasks )
+			delete task_;
+		mScanTasks.clear( );
+
+		// Reset. Notifications of cancelled Tasks ignored.
+		mScanPending = 0;
+		mRescanQueued = false;
+		mScanId++;
+
+	} /// ChannelModel::cancelScan
+
+	/**
+	  * Keeps fingerprint & Items hashes of read File,
+	  * so unchanged File not parsed again, and known Items of changed File not built.
+	  * Fingerprint of File not parsed whole removed, Items hashes kept.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pStats - File parsing statistics.
+	  * @param pFingerprint - File fingerprint.
+	  * @param pItemHashes - hashes of Items, read from File.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::setFingerprint( const ParseStats & pStats, const quint64 pFingerprint, const QSet<quint64> & pItemHashes ) noexcept
+	{
+
+		// Keep fingerprint & Items hashes, if File parsed whole.
+		if ( pStats.mParsed && pStats.mExceededLimit == ParseLimits::NO_LIMIT && pFingerprint != 0 )
+		{
+
+			// Keep fingerprint.
+			mFingerprints.insert( pStats.mPath, pFingerprint );
+
+			// Keep Items hashes, empty if Items not hashed (not scanned).
+			if ( pItemHashes.isEmpty( ) )
+				mItemHashes.remove( pStats.mPath );
+			else
+				mItemHashes.insert( pStats.mPath, pItemHashes );
+
+		}
+		else if ( !pStats.mUnchanged )
+			mFingerprints.remove( pStats.mPath );
+
+	} /// ChannelModel::setFingerprint
+
+	/**
+	  * Deletes incremental parser objects.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::releaseIncrementalParser( ) noexcept
+	{
+
+		// Delete Pull-Parser.
+		delete mIncrementalStream;
+		mIncrementalStream = nullptr;
+
+		// Delete SAX Xml-Reader.
+		delete mIncrementalReader;
+		mIncrementalReader = nullptr;
+
+		// Delete SAX Xml-InputSource.
+		delete mIncrementalSource;
+		mIncrementalSource = nullptr;
+
+		// Delete Handler, after Readers which use it. Keep Arena, bound by caller.
+		rss::ElementArena *const prevArena_( rss::ElementArena::bind( nullptr ) );
+		delete mIncrementalHandler;
+		mIncrementalHandler = nullptr;
+		rss::ElementArena::bind( prevArena_ );
+
+		// Close File.
+		delete mIncrementalFile;
+		mIncrementalFile = nullptr;
+
+		// Reset
+		mIncrementalStarted = false;
+		mIncrementalItems = 0;
+		mIncrementalBytes = 0;
+
+	} /// ChannelModel::releaseIncrementalParser
+
+	/**
+	  * Notifies Views, if Items added since last call.
+	  * Item-Views (Proxy-Models) read Items rows again by #itemsChanged.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::publishIncrementalItems( ) noexcept
+	{
+
+		// Count Items.
+		const int itemsCount_( mIncrementalHandler->countItems( ) );
+
+		// Cancel, if no new Items, or Channel not added yet (<link> not parsed).
+		if ( itemsCount_ == mIncrementalItems || !mIncrementalHandler->isChannelAdded( ) )
+			return;
+
+		// Remember published Items.
+		mIncrementalItems = itemsCount_;
+
+		// Update
+		onChannelsUpdated( );
+
+	} /// ChannelModel::publishIncrementalItems
+
+	/**
+	  * Starts parsing of RSS-document, fed by chunks.
+	  * Previous incremental parsing cancelled.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if started.
+	  * @throws - no exceptions.
+	**/
+	bool ChannelModel::beginIncrementalParse( ) noexcept
+	{
+
+		// Cancel previous parsing.
+		releaseIncrementalParser( );
+
+		// Create SAXRSSHandler instance. Handler Arena bound only while chunk parsed (#feed).
+		rss::ElementArena *const prevArena_( rss::ElementArena::bind( nullptr ) );
+		mIncrementalHandler = new rss::SAXRSSHandler( nullptr, this );
+		mIncrementalHandler->setLimits( mParseLimits );
+		rss::ElementArena::bind( prevArena_ );
+
+		// Pull-Parser
+		if ( mParserEngine == ParserEngine::STREAM_PARSER_ENGINE )
+			mIncrementalStream = new rss::StreamRSSReader( mIncrementalHandler );
+		else
+		{ // SAX, also used by fast Scanner (needs whole document).
+
+			// Create Xml-InputSource. Data set by each chunk.
+			mIncrementalSource = new QXmlInputSource( );
+
+			// Create default Xml-Reader.
+			mIncrementalReader = new QXmlSimpleReader( );
+
+			// Set SAX-Handler for Xml-Reader.
+			mIncrementalReader->setContentHandler( mIncrementalHandler );
+			mIncrementalReader->setErrorHandler( mIncrementalHandler );
+
+		} /// SAX
+
+		// Return TRUE
+		return( true );
+
+	} /// ChannelModel::beginIncrementalParse
+
+	/**
+	  * Parses next chunk of RSS-document.
+	  *
+	  * (?) Items closed (</item>) in this chunk published to Views.
+	  * Element split between chunks handled with next chunk.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pData - Document bytes.
+	  * @return - 'true' to continue, 'false' if error or limit reached (parsing cancelled).
+	  * @throws - no exceptions.
+	**/
+	bool ChannelModel::feed( const QByteArray & pData ) noexcept
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Check state.
+		assert( mIncrementalHandler != nullptr && "ChannelModel::feed - beginIncrementalParse not called !" );
+#else // !DEBUG
+		// Cancel, if parsing not started.
+		if ( mIncrementalHandler == nullptr )
+			return( false );
+#endif // DEBUG
+
+		// Bytes left before size limit.
+		const qint64 bytesLeft_( mParseLimits.mMaxBytes > 0 ? mParseLimits.mMaxBytes - mIncrementalBytes : static_cast<qint64>( pData.size( ) ) );
+
+		// 'true' if chunk cut by size limit.
+		const bool sizeLimited_( bytesLeft_ < pData.size( ) );
+
+		// Chunk, bytes after size limit ignored.
+		const QByteArray chunk_( sizeLimited_ ? pData.left( static_cast<int>( qMax( bytesLeft_, static_cast<qint64>( 0 ) ) ) ) : pData );
+		mIncrementalBytes += chunk_.size( );
+
+		// Bind Channel Arena only while chunk parsed: Items loaded by Views between chunks allocated on heap.
+		rss::ElementArena *const prevArena_( rss::ElementArena::bind( nullptr ) );
+		mIncrementalHandler->bindArena( );
+
+		// Result
+		bool result_( false );
+
+		// Pull-Parser
+		if ( mIncrementalStream != nullptr )
+		{
+
+			// Add chunk.
+			mIncrementalStream->addData( chunk_ );
+
+			// Parse
+			result_ = mIncrementalStream->parseContinue( );
+
+		} /// Pull-Parser
+		else
+		{ // SAX
+
+			// Set chunk. InputSource keeps decoder state between chunks.
+			mIncrementalSource->setData( chunk_ );
+
+			// Parse
+			result_ = mIncrementalStarted ? mIncrementalReader->parseContinue( ) : mIncrementalReader->parse( mIncrementalSource, true );
+
+			// Started
+			mIncrementalStarted = true;
+
+		} /// SAX
+
+		// Stop at size limit, Items closed so far kept.
+		if ( sizeLimited_ && result_ )
+			result_ = mIncrementalHandler->onLimitReached( ParseLimits::BYTES_LIMIT );
+
+		// Restore Arena.
+		rss::ElementArena::bind( prevArena_ );
+
+		// Publish closed Items.
+		publishIncrementalItems( );
+
+		// Cancel parsing on error.
+		if ( !result_ )
+		{
+
+			// Update
+			onChannelsUpdated( );
+
+			// Release
+			releaseIncrementalParser( );
+
+		} /// Cancel parsing on error.
+
+		// Return result.
+		return( result_ );
+
+	} /// ChannelModel::feed
+
+	/**
+	  * Completes parsing started with #beginIncrementalParse.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if document complete, 'false' if error or truncated.
+	  * @throws - no exceptions.
+	**/
+	bool ChannelModel::finish( ) noexcept
+	{
+
+		// Cancel, if parsing not started, or cancelled by error.
+		if ( mIncrementalHandler == nullptr )
+			return( false );
+
+		// Bind Channel Arena only while last chunk parsed.
+		rss::ElementArena *const prevArena_( rss::ElementArena::bind( nullptr ) );
+		mIncrementalHandler->bindArena( );
+
+		// Result
+		bool result_( false );
+
+		// Pull-Parser
+		if ( mIncrementalStream != nullptr )
+			result_ = mIncrementalStream->finish( );
+		else if ( mIncrementalStarted )
+		{ // SAX
+
+			// Empty chunk signals end of Document.
+			mIncrementalSource->setData( QByteArray( ) );
+
+			// Parse
+			result_ = mIncrementalReader->parseContinue( );
+
+		} /// SAX
+
+		// Restore Arena.
+		rss::ElementArena::bind( prevArena_ );
+
+		// Release
+		releaseIncrementalParser( );
+
+		// Update
+		onChannelsUpdated( );
+
+		// Return result.
+		return( result_ );
+
+	} /// ChannelModel::finish
+
+	/**
+	  * Feeds next chunk of File, opened by #parseRSSFileAsync.
+	  * Queues itself until File end reached.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::onIncrementalParseStep( ) noexcept
+	{
+
+		// Not queued anymore.
+		mIncrementalStepQueued = false;
+
+		// Cancel, if parsing cancelled.
+		if ( mIncrementalFile == nullptr )
+			return;
+
+		// Read chunk.
+		const QByteArray chunk_( mIncrementalFile->read( INCREMENTAL_CHUNK_SIZE ) );
+
+		// Complete parsing at File end.
+		if ( chunk_.isEmpty( ) )
+		{
+			finish( );
+			return;
+		}
+
+		// Parse chunk & queue next step.
+		if ( feed( chunk_ ) )
+		{
+			mIncrementalStepQueued = true;
+			QTimer::singleShot( 0, this, &ChannelModel::onIncrementalParseStep );
+		}
+
+	} /// ChannelModel::onIncrementalParseStep
+
+	/**
+	  * Read RSS-file by chunks, one chunk per event-loop turn.
+	  *
+	  * (?) Unlike #parseRSSFile, don't block GUI-thread for whole document.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pUrl - URL from QML.
+	  * @throws - no exceptions.
+	**/
+	void ChannelModel::parseRSSFileAsync( const QUrl pUrl ) noexcept
+	{
+
+		// Start parsing.
+		if ( !beginIncrementalParse( ) )
+			return;
+
+		// Open File.
+		mIncrementalFile = new QFile( pUrl.toLocalFile( ) );
+		if ( !mIncrementalFile->open( QIODevice::ReadOnly ) )
+		{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+			// Debug
+			qDebug( ) << "ChannelModel::parseRSSFileAsync - failed to open " << pUrl;
+#endif // DEBUG
+
+			// Cancel
+			releaseIncrementalParser( );
+			return;
+
+		} /// Open File.
+
+		// Queue first step, unless step of previous File still queued.
+		if ( !mIncrementalStepQueued )
+		{
+			mIncrementalStepQueued = true;
+			QTimer::singleShot( 0, this, &ChannelModel::onIncrementalParseStep );
+		}
+
+	} /// ChannelModel::parseRSSFileAsync
+
+	// ===========================================================
+	// OVERRIDE
+	// ===========================================================
+
+	Qt::ItemFlags ChannelModel::flags( const QModelIndex & pIndex ) const
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "ChannelModel::flags, index.row=" << pIndex.row( ) << "index.col=" << pIndex.column( ) << "index.pointer=" << QString( pIndex.internalPointer( ) != nullptr );
+#endif // DEBUG
+
+		// Return
+		return( Qt::ItemFlags( Qt::ItemFlag::ItemIsEnabled | Qt::ItemFlag::ItemIsSelectable ) );
+
+	}
+
+	/**
+	  * Extract specific data using index.
+	  *
+	  * @threadsafe - thread-lock used.
+	  * @param pIndex - Model-Index, contains inner-data (RSS Channel || Item).
+	  * @param pRole - Model-Item Role, default is DisplayRole (Text).
+	  * @return - QVariant with data.
+	  * @throws - no exceptions.
+	**/
+	QVariant ChannelModel::data( const QModelIndex & pIndex, int pRole ) const
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
 		// Debug
 		qDebug( ) << "ChannelModel::data, index.row=" << pIndex.row( ) << "index.col=" << pIndex.column( ) << "index.pointer=" << QString( pIndex.internalPointer( ) != nullptr );
 
@@ -1161,6 +2994,21 @@ namespace rss
 		// Enclosure Mime-Type.
 		rolesMap[rss::ChannelModel::Roles::RSS_ENCLOSURE_ELEMENT_TYPE_ROLE] = "enclosure_type";
 
+		// content:encoded
+		rolesMap[rss::ChannelModel::Roles::RSS_CONTENT_ENCODED_ELEMENT_ROLE] = "content_encoded";
+
+		// dc:creator
+		rolesMap[rss::ChannelModel::Roles::RSS_DC_CREATOR_ELEMENT_ROLE] = "dc_creator";
+
+		// dc:date
+		rolesMap[rss::ChannelModel::Roles::RSS_DC_DATE_ELEMENT_ROLE] = "dc_date";
+
+		// media:thumbnail url
+		rolesMap[rss::ChannelModel::Roles::RSS_MEDIA_THUMBNAIL_ELEMENT_ROLE] = "media_thumbnail";
+
+		// media:content url
+		rolesMap[rss::ChannelModel::Roles::RSS_MEDIA_CONTENT_ELEMENT_ROLE] = "media_content";
+
 		// Return Model-Roles.
 		return( rolesMap );
 
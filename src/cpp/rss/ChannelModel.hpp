@@ -42,6 +42,11 @@
 #include <qvector.h>
 #endif // !QVECTOR_H
 
+// Include QSet
+#ifndef QSET_H
+#include <qset.h>
+#endif // !QSET_H
+
 // Include QMutex
 #ifndef QMUTEX_H
 #include <qmutex.h>
@@ -102,6 +107,78 @@
 #include "TextInput.hpp"
 #endif // !QRSS_READER_TEXT_INPUT_HPP
 
+// Include QByteArray
+#ifndef QBYTEARRAY_H
+#include <qbytearray.h>
+#endif // !QBYTEARRAY_H
+
+// Include rss::ParseLimits
+#ifndef QRSS_READER_PARSE_LIMITS_HPP
+#include "../utils/ParseLimits.hpp"
+#endif // !QRSS_READER_PARSE_LIMITS_HPP
+
+// Include rss::ParseDiagnostics
+#ifndef QRSS_READER_PARSE_DIAGNOSTICS_HPP
+#include "../utils/ParseDiagnostics.hpp"
+#endif // !QRSS_READER_PARSE_DIAGNOSTICS_HPP
+
+// Include rss::ParseStats
+#ifndef QRSS_READER_PARSE_STATS_HPP
+#include "../utils/ParseStats.hpp"
+#endif // !QRSS_READER_PARSE_STATS_HPP
+
+// Include rss::PoolStats
+#ifndef QRSS_READER_POOL_STATS_HPP
+#include "../utils/PoolStats.hpp"
+#endif // !QRSS_READER_POOL_STATS_HPP
+
+// ===========================================================
+// FORWARD-DECLARATIONS
+// ===========================================================
+
+// Forward-declare QFile
+#if !defined( QFILE_H ) && !defined( QFILE_DECL )
+#define QFILE_DECL
+class QFile;
+#endif // !QFILE_H
+
+// Forward-declare QXmlSimpleReader & QXmlInputSource
+#if !defined( QXML_H ) && !defined( QXML_DECL )
+#define QXML_DECL
+class QXmlSimpleReader;
+class QXmlInputSource;
+#endif // !QXML_H
+
+// Forward-declare QFileSystemWatcher
+#if !defined( QFILESYSTEMWATCHER_H ) && !defined( QFILESYSTEMWATCHER_DECL )
+#define QFILESYSTEMWATCHER_DECL
+class QFileSystemWatcher;
+#endif // !QFILESYSTEMWATCHER_H
+
+// Forward-declare QTimer
+#if !defined( QTIMER_H ) && !defined( QTIMER_DECL )
+#define QTIMER_DECL
+class QTimer;
+#endif // !QTIMER_H
+
+// Forward-declare QThreadPool
+#if !defined( QTHREADPOOL_H ) && !defined( QTHREADPOOL_DECL )
+#define QTHREADPOOL_DECL
+class QThreadPool;
+#endif // !QTHREADPOOL_H
+
+// Forward-declare rss::SAXRSSHandler
+#ifndef QRSS_READER_SAX_RSS_HANDLER_DECL
+#define QRSS_READER_SAX_RSS_HANDLER_DECL
+namespace rss { class SAXRSSHandler; }
+#endif // !QRSS_READER_SAX_RSS_HANDLER_DECL
+
+// Forward-declare rss::StreamRSSReader
+#ifndef QRSS_READER_STREAM_RSS_READER_DECL
+#define QRSS_READER_STREAM_RSS_READER_DECL
+namespace rss { class StreamRSSReader; }
+#endif // !QRSS_READER_STREAM_RSS_READER_DECL
+
 // ===========================================================
 // ChannelModel
 // ===========================================================
@@ -139,6 +216,32 @@ namespace rss
 		// SIGNALS
 		// ===========================================================
 
+	signals:
+
+		/**
+		  * Emitted after RSS-file read.
+		  *
+		  * @param pStats - parsing statistics.
+		**/
+		void parseFinished( const rss::ParseStats & pStats );
+
+		/**
+		  * Emitted before Items, replaced by parsing, deleted.
+		  * Views (Proxy-Models) must drop Items, read before.
+		**/
+		void itemsRetired( );
+
+		/**
+		  * Emitted when Items rows of Channels changed (added, replaced, removed).
+		  * Views (Proxy-Models) must read Items rows again.
+		**/
+		void itemsChanged( );
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
 
 		// ===========================================================
 		// CONFIG
@@ -147,6 +250,12 @@ namespace rss
 		/** Alias for Channel pointer. **/
 		using channel_ptr_t = rss::Channel*;
 
+		/**
+		  * ParseTask - parses one RSS-file on a thread-pool to a staging Channel.
+		  * Defined in ChannelModel.cpp.
+		**/
+		class ParseTask;
+
 		// -----------------------------------------------------------
 
 	private:
@@ -163,6 +272,277 @@ namespace rss
 		/** RSS Channels collection (container). Collection is private (inner), so no sorting are made. **/
 		QVector<channel_ptr_t> mChannels;
 
+		/** Fingerprints (xxHash64) of Files bytes, Channels read from. Cleared with Channels. **/
+		QMap<QString, quint64> mFingerprints;
+
+		/** Hashes (xxHash64) of Items bytes, by File-Path. Known Items of changed File not built. Cleared with Channels. **/
+		QMap<QString, QSet<quint64>> mItemHashes;
+
+		/** Xml Parser Engine used by #readFile. **/
+		int mParserEngine;
+
+		/** Limits of one RSS-document parsing. **/
+		ParseLimits mParseLimits;
+
+		/** 'true' if malformed Items dropped & parsing continued. **/
+		bool mRecoveryMode;
+
+		/** 'true' if HTML removed from Descriptions. **/
+		bool mStripHtml;
+
+		/** Problems of last parsing, by File-Path. Files without problems not stored. **/
+		QMap<QString, ParseDiagnostics> mDiagnostics;
+
+		/** Size of chunk, read by #parseRSSFileAsync per event-loop turn. **/
+		static constexpr qint64 INCREMENTAL_CHUNK_SIZE = 64 * 1024;
+
+		/** Incremental parsing: RSS Handler, null if no parsing started. **/
+		rss::SAXRSSHandler * mIncrementalHandler;
+
+		/** Incremental parsing: SAX Xml-Reader. **/
+		QXmlSimpleReader * mIncrementalReader;
+
+		/** Incremental parsing: SAX Xml-InputSource. **/
+		QXmlInputSource * mIncrementalSource;
+
+		/** Incremental parsing: Pull-Parser. **/
+		rss::StreamRSSReader * mIncrementalStream;
+
+		/** Incremental parsing: 'true' when first chunk passed to SAX Xml-Reader. **/
+		bool mIncrementalStarted;
+
+		/** Incremental parsing: number of Items, which Views notified about. **/
+		int mIncrementalItems;
+
+		/** Incremental parsing: number of Document bytes passed to parser. **/
+		qint64 mIncrementalBytes;
+
+		/** Incremental parsing: File read by #parseRSSFileAsync. **/
+		QFile * mIncrementalFile;
+
+		/** Incremental parsing: 'true' if #onIncrementalParseStep queued. **/
+		bool mIncrementalStepQueued;
+
+		/** Watched File state, compared to detect changed Files. Content compared by fingerprint. **/
+		struct WatchedFile
+		{
+
+			/** File size. **/
+			qint64 mSize;
+
+			/** Modification time, ms since epoch. **/
+			qint64 mModified;
+
+		}; /// WatchedFile
+
+		/** Delay after last change in watched directory, before Files read (ms). **/
+		static constexpr int WATCH_DEBOUNCE_INTERVAL = 500;
+
+		/** Watched directory, empty if not watched. **/
+		QString mWatchedDir;
+
+		/** Watcher of directory & its Files, null if not watched. **/
+		QFileSystemWatcher * mWatcher;
+
+		/** Debounce timer, restarted by every change. **/
+		QTimer * mWatchTimer;
+
+		/** States of Files read from watched directory. **/
+		QMap<QString, WatchedFile> mWatchedFiles;
+
+		/** Thread-pool, reading Files (opened, or of watched directory). Null if not used yet. **/
+		QThreadPool * mScanPool;
+
+		/** Tasks, reading Files (opened, or of watched directory). Merged, when all finished. **/
+		QVector<ParseTask*> mScanTasks;
+
+		/** Number of #mScanTasks, not finished yet. **/
+		int mScanPending;
+
+		/** Number of Files readings, so Tasks of cancelled reading ignored. **/
+		int mScanId;
+
+		/** 'true' if watched directory changed while it's Files read, so read again after merge. **/
+		bool mRescanQueued;
+
+		/** 'true' if #reclaimChannels queued. **/
+		bool mReclaimQueued;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Searches added Channel using Link Element as Key.
+		  *
+		  * @threadsafe - must be called only while thread-lock locked.
+		  * @param pLink - Link Element Value (Url).
+		  * @returns - Channel if found, null if not.
+		  * @throws - no exceptions.
+		**/
+		channel_ptr_t searchChannelByLink( const QUrl & pLink ) const noexcept;
+
+		/**
+		  * Adds staging Channel, or merges it to added Channel with the same Link.
+		  * Merged staging Channel, or Channel without Link, deleted.
+		  *
+		  * @threadsafe - must be called only while thread-lock locked.
+		  * @param pChannel - staging Channel.
+		  * @throws - no exceptions.
+		**/
+		void mergeChannel( rss::Channel *const pChannel ) noexcept;
+
+		/**
+		  * Counts Items of all Channels.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - number of Items.
+		  * @throws - no exceptions.
+		**/
+		int countItems( ) const noexcept;
+
+		/**
+		  * Parses RSS-file.
+		  *
+		  * (?) File memory-mapped if possible, parsers read mapped pages through QBuffer.
+		  * Parsing stops, when any of Handler limits reached.
+		  *
+		  * Fingerprint (xxHash64) computed over mapped bytes, so File read once.
+		  * File with the same fingerprint not parsed (ParseStats#mUnchanged).
+		  *
+		  * @threadsafe - thread-safe, if Handler is not shared.
+		  * @param pFile - File to read.
+		  * @param pHandler - RSS Handler.
+		  * @param pEngine - ParserEngine.
+		  * @param pPrevFingerprint - fingerprint of File bytes, when File read last time. 0 if not read.
+		  * @param pFingerprint - fingerprint of File bytes, 0 if File not mapped whole.
+		  * @return - 'true' if document parsed or unchanged, 'false' if error or limit reached.
+		  * @throws - no exceptions.
+		**/
+		static bool parseFile( QFile & pFile, rss::SAXRSSHandler & pHandler, const int pEngine, const quint64 pPrevFingerprint, quint64 & pFingerprint ) noexcept;
+
+		/**
+		  * Stores problems of parsed File.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pPath - File-Path.
+		  * @param pDiagnostics - ParseDiagnostics.
+		  * @throws - no exceptions.
+		**/
+		void setDiagnostics( const QString & pPath, const ParseDiagnostics & pDiagnostics ) noexcept;
+
+		/**
+		  * Deletes incremental parser objects.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		void releaseIncrementalParser( ) noexcept;
+
+		/**
+		  * Notifies Views, if Items added since last call.
+		  * Item-Views (Proxy-Models) read Items rows again by #itemsChanged.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		void publishIncrementalItems( ) noexcept;
+
+		/**
+		  * Feeds next chunk of File, opened by #parseRSSFileAsync.
+		  * Queues itself until File end reached.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		void onIncrementalParseStep( ) noexcept;
+
+		/**
+		  * Called when watched directory, or its File, changed.
+		  * Restarts debounce timer, so burst of writes read once.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pPath - changed path.
+		  * @throws - no exceptions.
+		**/
+		void onWatchedPathChanged( const QString & pPath ) noexcept;
+
+		/**
+		  * Reads new & changed Files of watched directory.
+		  * File read again, only if it's size or modification time, & content fingerprint changed.
+		  * Files read on thread-pool, so GUI-thread not blocked. Channels merged by #onScanTaskFinished.
+		  * Reading, requested while previous not merged, queued.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		void scanWatchedDirectory( ) noexcept;
+
+		/**
+		  * Starts Tasks, reading Files on thread-pool.
+		  * Tasks added to running reading (#mScanTasks), if any, so all merged once.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pUrls - Files URLs.
+		  * @throws - no exceptions.
+		**/
+		void startParseTasks( const QList<QUrl> & pUrls ) noexcept;
+
+		/**
+		  * Called by ParseTask of Files reading (opened, or of watched directory), when it's File parsed.
+		  * When all Tasks finished, their staging Channels merged & Views notified once.
+		  *
+		  * (?) Queued to GUI-thread by worker thread.
+		  *
+		  * @threadsafe - not thread-safe, called only by GUI-thread.
+		  * @param pScanId - Id of Files reading (#mScanId).
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE void onScanTaskFinished( const int pScanId ) noexcept;
+
+		/**
+		  * Cancels Files reading. Waits for running Tasks,
+		  * deletes Tasks & their staging Channels.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		void cancelScan( ) noexcept;
+
+		/**
+		  * Adds (merges) staging Channels of finished Tasks under one thread-lock,
+		  * keeps problems & fingerprints, then Views notified once.
+		  * Tasks deleted.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pTasks - finished Tasks.
+		  * @throws - no exceptions.
+		**/
+		void mergeParseTasks( const QVector<ParseTask*> & pTasks ) noexcept;
+
+		/**
+		  * Deletes Elements & Items, replaced in Channels by parsing.
+		  * Queued by #onChannelsUpdated, so runs when Views don't use them (safe point).
+		  * Views keeping Items notified by #itemsRetired first.
+		  *
+		  * @threadsafe - not thread-safe, called only by GUI-thread.
+		  * @throws - no exceptions.
+		**/
+		void reclaimChannels( ) noexcept;
+
+		/**
+		  * Keeps fingerprint & Items hashes of read File,
+		  * so unchanged File not parsed again, and known Items of changed File not built.
+		  * Fingerprint of File not parsed whole removed, Items hashes kept.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pStats - File parsing statistics.
+		  * @param pFingerprint - File fingerprint.
+		  * @param pItemHashes - hashes of Items, read from File.
+		  * @throws - no exceptions.
+		**/
+		void setFingerprint( const ParseStats & pStats, const quint64 pFingerprint, const QSet<quint64> & pItemHashes ) noexcept;
+
 		// -----------------------------------------------------------
 
 	public:
@@ -328,10 +708,50 @@ namespace rss
 			  * <enclosure type="mime/type">
 			  * If Element not found, returns invalid QVariant.
 			**/
-			RSS_ENCLOSURE_ELEMENT_TYPE_ROLE = Qt::UserRole + 37
+			RSS_ENCLOSURE_ELEMENT_TYPE_ROLE = Qt::UserRole + 37,
+
+			/** <content:encoded>HTML</content:encoded>. If Element not found, returns invalid QVariant. **/
+			RSS_CONTENT_ENCODED_ELEMENT_ROLE = Qt::UserRole + 38,
+
+			/** <dc:creator>NAME</dc:creator>. If Element not found, returns invalid QVariant. **/
+			RSS_DC_CREATOR_ELEMENT_ROLE = Qt::UserRole + 39,
+
+			/** <dc:date>DATE</dc:date>. If Element not found, returns invalid QVariant. **/
+			RSS_DC_DATE_ELEMENT_ROLE = Qt::UserRole + 40,
+
+			/** <media:thumbnail url="URL" />. If Element not found, returns invalid QVariant. **/
+			RSS_MEDIA_THUMBNAIL_ELEMENT_ROLE = Qt::UserRole + 41,
+
+			/** <media:content url="URL" />. If Element not found, returns invalid QVariant. **/
+			RSS_MEDIA_CONTENT_ELEMENT_ROLE = Qt::UserRole + 42
 
 		}; // Roles
 
+		/**
+		  * ParserEngine - Xml Parser Engines, used to read RSS-documents.
+		**/
+		enum ParserEngine
+		{
+
+			/** QXmlSimpleReader (SAX2 callbacks). **/
+			SAX_PARSER_ENGINE = 0,
+
+			/** QXmlStreamReader (pull-parser). **/
+			STREAM_PARSER_ENGINE = 1,
+
+			/** rss::FastRSSScanner (SIMD), falls back to SAX for unsupported documents. **/
+			FAST_PARSER_ENGINE = 2,
+
+			/**
+			  * rss::FastRSSScanner, Items only indexed (File offsets) & loaded when Views request them.
+			  * Falls back to SAX (all Items loaded) for unsupported documents.
+			**/
+			LAZY_PARSER_ENGINE = 3
+
+		}; // ParserEngine
+
+		Q_ENUM( ParserEngine )
+
 		// ===========================================================
 		// CONSTRUCTOR
 		// ===========================================================
@@ -424,6 +844,28 @@ namespace rss
 		**/
 		QVariant getItemData( rss::Item *const pItem, const int pRole ) const noexcept;
 
+		/**
+		  * Returns value of Item extension (<content:encoded>, <dc:creator>, etc).
+		  *
+		  * @threadsafe - must be called only while thread-lock locked.
+		  * @param pItem - RSS Item.
+		  * @param pTag - Extension Tag.
+		  * @return - QVariant with value, or invalid QVariant.
+		  * @throws - no exceptions.
+		**/
+		static QVariant getExtensionData( const rss::Item *const pItem, const RSSTag pTag ) noexcept;
+
+		/**
+		  * Returns Channel's Item, loads it from RSS-file if only indexed.
+		  *
+		  * @threadsafe - thread-safe, Channel thread-locks used.
+		  * @param pChannel - RSS Channel-class.
+		  * @param pIndex - Item index.
+		  * @return - Item, or null if not found or File can't be read.
+		  * @throws - no exceptions.
+		**/
+		static rss::Item * loadItem( rss::Channel *const pChannel, const int pIndex ) noexcept;
+
 		/**
 		  * Deletes all Channels.
 		  *
@@ -445,9 +887,19 @@ namespace rss
 		**/
 		rss::Channel * addChannel( rss::Channel *const pChannel, const bool pLock ) noexcept;
 
+		/**
+		  * Adds staging Channel, or merges it to added Channel with the same Link.
+		  * Merged staging Channel, or Channel without Link, deleted.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pChannel - staging Channel.
+		  * @throws - no exceptions.
+		**/
+		void addStagingChannel( rss::Channel *const pChannel ) noexcept;
+
 		/**
 		  * Called after RSS parsing complete.
-		  * Cause attach Views to Update.
+		  * Cause attach Views to Update. #itemsChanged emitted, if Channels Items rows changed.
 		  *
 		  * @threadsafe - not thread-safe.
 		  * @throws - no exceptions.
@@ -467,6 +919,118 @@ namespace rss
 		**/
 		void readFile( const QString & pSrc, rss::Channel *const pChannel ) noexcept;
 
+		/**
+		  * Returns Xml Parser Engine used to read RSS-documents.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - ParserEngine.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE int getParserEngine( ) const noexcept;
+
+		/**
+		  * Sets Xml Parser Engine used to read RSS-documents.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pEngine - ParserEngine.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE void setParserEngine( const int pEngine ) noexcept;
+
+		/**
+		  * Returns limits of one RSS-document parsing.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - ParseLimits.
+		  * @throws - no exceptions.
+		**/
+		const ParseLimits & getParseLimits( ) const noexcept;
+
+		/**
+		  * Sets limits of one RSS-document parsing.
+		  * Items accepted before limit reached are kept.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pLimits - ParseLimits, 0 means no limit.
+		  * @throws - no exceptions.
+		**/
+		void setParseLimits( const ParseLimits & pLimits ) noexcept;
+
+		/**
+		  * Returns 'true' if recovery mode enabled.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE bool getRecoveryMode( ) const noexcept;
+
+		/**
+		  * Enables recovery mode: malformed Item dropped, parsing
+		  * continues from the next Item, so well-formed Items kept.
+		  *
+		  * (?) Recovery done by fast Scanner, so used for mapped Files by any ParserEngine.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pRecovery - 'true' to recover.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE void setRecoveryMode( const bool pRecovery ) noexcept;
+
+		/**
+		  * Returns 'true' if HTML removed from Descriptions.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE bool getStripHtml( ) const noexcept;
+
+		/**
+		  * Enables removing of HTML tags & entities from Descriptions.
+		  * Stripped Text cached with decoded Descriptions.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pStrip - 'true' to show plain Text.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE void setStripHtml( const bool pStrip ) noexcept;
+
+		/**
+		  * Returns problems of last File parsing.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pPath - File-Path.
+		  * @return - ParseDiagnostics, empty if File parsed without problems.
+		  * @throws - no exceptions.
+		**/
+		ParseDiagnostics getDiagnostics( const QString & pPath ) const noexcept;
+
+		/**
+		  * Returns statistics of Texts pool, used by lazy-loaded Items & updated Files.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @return - PoolStats.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE rss::PoolStats getTextPoolStats( ) const noexcept;
+
+		/**
+		  * Returns statistics of Links pool, used by lazy-loaded Items & updated Files.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @return - PoolStats.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE rss::PoolStats getLinkPoolStats( ) const noexcept;
+
+		/**
+		  * Returns statistics of Dates pool, used by lazy-loaded Items & updated Files.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @return - PoolStats.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE rss::PoolStats getDatePoolStats( ) const noexcept;
+
 		/**
 		  * Read RSS-file using QUrl.
 		  *
@@ -476,6 +1040,84 @@ namespace rss
 		**/
 		Q_INVOKABLE void parseRSSFile( const QUrl pUrl ) noexcept;
 
+		/**
+		  * Starts parsing of RSS-document, fed by chunks.
+		  * Previous incremental parsing cancelled.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if started.
+		  * @throws - no exceptions.
+		**/
+		bool beginIncrementalParse( ) noexcept;
+
+		/**
+		  * Parses next chunk of RSS-document.
+		  *
+		  * (?) Items closed (</item>) in this chunk published to Views.
+		  * Element split between chunks handled with next chunk.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pData - Document bytes.
+		  * @return - 'true' to continue, 'false' if error or limit reached (parsing cancelled).
+		  * @throws - no exceptions.
+		**/
+		bool feed( const QByteArray & pData ) noexcept;
+
+		/**
+		  * Completes parsing started with #beginIncrementalParse.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if document complete, 'false' if error or truncated.
+		  * @throws - no exceptions.
+		**/
+		bool finish( ) noexcept;
+
+		/**
+		  * Read RSS-file by chunks, one chunk per event-loop turn.
+		  *
+		  * (?) Unlike #parseRSSFile, don't block GUI-thread for whole document.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pUrl - URL from QML.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE void parseRSSFileAsync( const QUrl pUrl ) noexcept;
+
+		/**
+		  * Read RSS-files in parallel.
+		  *
+		  * (?) Each File parsed on a thread-pool to own staging Channel.
+		  * GUI-thread not blocked, staging Channels added (merged)
+		  * under one thread-lock by #onScanTaskFinished, then Views notified once.
+		  * Files, opened while other Files read, merged with them.
+		  *
+		  * @threadsafe - not thread-safe, called only by GUI-thread.
+		  * @param pUrls - Files URLs.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE void parseRSSFiles( const QList<QUrl> & pUrls ) noexcept;
+
+		/**
+		  * Reads all RSS-files of directory & watches it.
+		  * New & changed Files read again (in parallel) after burst of writes ends,
+		  * their Channels merged with added Channels.
+		  * Previous watched directory replaced.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pPath - directory path.
+		  * @return - 'true' if watched, 'false' if directory not found.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE bool watchDirectory( const QString & pPath ) noexcept;
+
+		/**
+		  * Stops watching directory. Read Channels kept, Files read now still merged.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		Q_INVOKABLE void unwatchDirectory( ) noexcept;
+
 		Q_INVOKABLE QModelIndex getInvalidIndex( ) noexcept
 		{
 			return( QModelIndex( ) );
@@ -29,6 +29,11 @@
 #include "Date.hpp"
 #endif // !QRSS_READER_DATE_HPP
 
+// Include rss::ElementPool
+#ifndef QRSS_READER_ELEMENT_POOL_HPP
+#include "../utils/ElementPool.hpp"
+#endif // !QRSS_READER_ELEMENT_POOL_HPP
+
 // ===========================================================
 // Date
 // ===========================================================
@@ -52,7 +57,8 @@ namespace rss
 	**/
 	Date::Date( const QString & pDate, Element *const parentElement, const Element::Type pType ) noexcept
 		: Element ( pType, parentElement ),
-		  mStringDate( pDate )
+		  mStringDate( pDate ),
+		  mEpoch( parseEpoch( pDate ) )
 	{
 	}
 
@@ -75,24 +81,74 @@ namespace rss
 	  * Returns 'true' if src-Date is newer then dst-Date.
 	  *
 	  * @threadsafe - not thread-safe.
-	  * @param srcDate - Date #1.
-	  * @param dstDate - Date #2.
+	  * @param srcDate - Date #1, or null.
+	  * @param dstDate - Date #2, or null.
 	  * @throws - no exceptions.
 	**/
 	bool Date::isNewer( const Date *const srcDate, const Date *const dstDate ) noexcept
 	{
 
-		// src-Date.
-		QDate date_1( QDate::fromString( srcDate->mStringDate ) );
+		// src-Date not set.
+		if ( srcDate == nullptr )
+			return( false );
 
-		// dst-Date.
-		QDate date_2( QDate::fromString( dstDate->mStringDate ) );
+		// dst-Date not set.
+		if ( dstDate == nullptr )
+			return( true );
 
-		// Comapre.
-		return( date_1 > date_2 );
+		// Compare epochs.
+		return( srcDate->mEpoch > dstDate->mEpoch );
 
 	}
 
+	/**
+	  * Parses Date (RFC 2822 for RSS, ISO 8601 for Atom).
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pDate - Date string.
+	  * @return - milliseconds since epoch (UTC), 0 if Date can't be parsed.
+	  * @throws - no exceptions.
+	**/
+	qint64 Date::parseEpoch( const QString & pDate ) noexcept
+	{
+
+		// Cancel, if no Date.
+		if ( pDate.isEmpty( ) )
+			return( 0 );
+
+		// RSS <pubDate>, <lastBuildDate>.
+		QDateTime dateTime_( QDateTime::fromString( pDate.trimmed( ), Qt::RFC2822Date ) );
+
+		// Atom <updated>, <published>, Dublin Core <dc:date>.
+		if ( !dateTime_.isValid( ) )
+			dateTime_ = QDateTime::fromString( pDate.trimmed( ), Qt::ISODate );
+
+		// Return epoch, or 0.
+		return( dateTime_.isValid( ) ? dateTime_.toMSecsSinceEpoch( ) : 0 );
+
+	} /// Date::parseEpoch
+
+	/**
+	  * Allocates Date from Channel Arena, bound to calling thread, or Dates pool.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pSize - Date size.
+	  * @return - memory.
+	  * @throws - std::bad_alloc.
+	**/
+	void * Date::operator new( size_t pSize )
+	{ return( ElementPool<Date>::allocate( pSize ) ); }
+
+	/**
+	  * Releases Date memory to Dates pool. Memory of Arena Date freed with Arena.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pMemory - memory.
+	  * @throws - no exceptions.
+	**/
+	void Date::operator delete( void * pMemory ) noexcept
+	{ ElementPool<Date>::release( pMemory ); }
+
 	// -----------------------------------------------------------
 
 } // rss
@@ -57,6 +57,7 @@ namespace rss
 	  * @brief
 	  * Date - used by pubDate & lastBuildDate Elements.
 	  * Data stored with QString for easier cast (transformation).
+	  * Date parsed once (RFC 2822, ISO 8601) to epoch, used for comparing & sorting.
 	  *
 	  * @version 1.0
 	  * @since 21.07.2019
@@ -74,6 +75,9 @@ namespace rss
 		/** Date in QString format. **/
 		const QString mStringDate;
 
+		/** Milliseconds since epoch (UTC), 0 if Date can't be parsed. **/
+		const qint64 mEpoch;
+
 		// ===========================================================
 		// CONSTRUCTOR
 		// ===========================================================
@@ -113,6 +117,35 @@ namespace rss
 		**/
 		static bool isNewer( const Date *const srcDate, const Date *const dstDate ) noexcept;
 
+		/**
+		  * Parses Date (RFC 2822 for RSS, ISO 8601 for Atom).
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pDate - Date string.
+		  * @return - milliseconds since epoch (UTC), 0 if Date can't be parsed.
+		  * @throws - no exceptions.
+		**/
+		static qint64 parseEpoch( const QString & pDate ) noexcept;
+
+		/**
+		  * Allocates Date from Channel Arena, bound to calling thread, or Dates pool.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pSize - Date size.
+		  * @return - memory.
+		  * @throws - std::bad_alloc.
+		**/
+		static void * operator new( size_t pSize );
+
+		/**
+		  * Releases Date memory to Dates pool. Memory of Arena Date freed with Arena.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pMemory - memory.
+		  * @throws - no exceptions.
+		**/
+		static void operator delete( void * pMemory ) noexcept;
+
 		// -----------------------------------------------------------
 
 	private:
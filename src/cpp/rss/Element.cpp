@@ -29,6 +29,11 @@
 #include "Element.hpp"
 #endif // !QRSS_READER_ELEMENT_HPP
 
+// Include rss::ElementArena
+#ifndef QRSS_READER_ELEMENT_ARENA_HPP
+#include "../utils/ElementArena.hpp"
+#endif // !QRSS_READER_ELEMENT_ARENA_HPP
+
 // ===========================================================
 // ELEMENT
 // ===========================================================
@@ -45,6 +50,9 @@ namespace rss
 	/** Elements ID Storage. **/
 	IDStorage<unsigned long> Element::mElementsIDStorage;
 
+	/** Number of Elements created by thread. **/
+	thread_local qint64 Element::mAllocations( 0 );
+
     // ===========================================================
     // CONSTRUCTOR
     // ===========================================================
@@ -61,6 +69,10 @@ namespace rss
 		  type( pType ),
 		  parent( parentElement )
     {
+
+		// Count allocation.
+		mAllocations++;
+
     }
 
     // ===========================================================
@@ -116,6 +128,38 @@ namespace rss
     T* Element::castTo( Element *const pElement ) noexcept
     { return( static_cast<T*>( pElement ) ); }
 
+	/**
+	  * Returns number of Elements created by calling thread.
+	  * Used to count parsing allocations.
+	  *
+	  * @threadsafe - thread-safe, counter is per-thread.
+	  * @return - number of Elements created.
+	  * @throws - no exceptions.
+	**/
+	qint64 Element::countAllocations( ) noexcept
+	{ return( mAllocations ); }
+
+	/**
+	  * Allocates Element from Channel Arena, bound to calling thread, or heap.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pSize - Element size.
+	  * @return - memory.
+	  * @throws - std::bad_alloc.
+	**/
+	void * Element::operator new( size_t pSize )
+	{ return( ElementArena::allocate( pSize ) ); }
+
+	/**
+	  * Releases Element memory. Memory of Arena Element freed with Arena.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pMemory - memory.
+	  * @throws - no exceptions.
+	**/
+	void Element::operator delete( void * pMemory ) noexcept
+	{ ElementArena::release( pMemory ); }
+
     // -----------------------------------------------------------
 
 } // rss
@@ -32,6 +32,9 @@
 #include "../utils/IDStorage.hpp"
 #endif // !QRSS_READER_ID_STORAGE_HPP
 
+// Include C++ size_t.
+#include <cstddef>
+
 // ===========================================================
 // FORWARD-DECLARATIONS
 // ===========================================================
@@ -250,6 +253,35 @@ namespace rss
         template <typename T>
         static T* castTo( Element *const pElement ) noexcept;
 
+		/**
+		  * Returns number of Elements created by calling thread.
+		  * Used to count parsing allocations.
+		  *
+		  * @threadsafe - thread-safe, counter is per-thread.
+		  * @return - number of Elements created.
+		  * @throws - no exceptions.
+		**/
+		static qint64 countAllocations( ) noexcept;
+
+		/**
+		  * Allocates Element from Channel Arena, bound to calling thread, or heap.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pSize - Element size.
+		  * @return - memory.
+		  * @throws - std::bad_alloc.
+		**/
+		static void * operator new( size_t pSize );
+
+		/**
+		  * Releases Element memory. Memory of Arena Element freed with Arena.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pMemory - memory.
+		  * @throws - no exceptions.
+		**/
+		static void operator delete( void * pMemory ) noexcept;
+
         // -----------------------------------------------------------
 
     private:
@@ -263,6 +295,9 @@ namespace rss
 		/** Elements ID Storage. **/
 		static IDStorage<unsigned long> mElementsIDStorage;
 
+		/** Number of Elements created by thread. **/
+		static thread_local qint64 mAllocations;
+
         // ===========================================================
         // DELETED CONSTRUCTORS & OPERATORS
         // ===========================================================
@@ -34,6 +34,11 @@
 #include "Date.hpp" // PubDate
 #endif // !QRSS_READER_DATE_HPP
 
+// Include qPopulationCount, qCountTrailingZeroBits
+#ifndef QALGORITHMS_H
+#include <qalgorithms.h>
+#endif // !QALGORITHMS_H
+
 // ===========================================================
 // Item
 // ===========================================================
@@ -43,6 +48,15 @@ namespace rss
 
 	// -----------------------------------------------------------
 
+	// ===========================================================
+	// CONSTANTS
+	// ===========================================================
+
+	constexpr int Item::ELEMENT_SLOTS;
+
+	// Elements mask must have bit for each slot.
+	static_assert( Item::ELEMENT_SLOTS <= 32, "Item::elementsMask - too many Element types !" );
+
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -54,7 +68,10 @@ namespace rss
 	  * @throws - no exceptions.
 	**/
 	Item::Item( Element *const parentElement ) noexcept
-		: Element( ElementType::CHANNEL_ITEM, parentElement )
+		: Element( ElementType::CHANNEL_ITEM, parentElement ),
+		  elements( ),
+		  elementsMask( 0 ),
+		  extensions( )
 	{ }
 
 	// ===========================================================
@@ -92,15 +109,12 @@ namespace rss
 	Item::element_ptr_t Item::getElement( const ElementType pType ) const noexcept
 	{
 
-		// Search Element.
-		auto elementPos_ = elements.find( pType );
-
-		// Cancel, if Element not found.
-		if ( elementPos_ == elements.cend( ) )
+		// Cancel, if Item can't store this type.
+		if ( pType >= ELEMENT_SLOTS )
 			return( element_ptr_t( nullptr ) );
 
-		// Return Element.
-		return( elementPos_.value( ) );
+		// Return Element, or null.
+		return( elements[pType] );
 
 	} /// Item::getElement
 
@@ -115,33 +129,135 @@ namespace rss
 	bool Item::setElement( Item::element_ptr_t pElement ) noexcept
 	{
 
-		// Search Element.
-		auto elementPos_ = elements.find( pElement->type );
+		// Element-Type.
+		const ElementType type_( pElement->type );
+
+		// Cancel, if Item can't store this type.
+		if ( type_ >= ELEMENT_SLOTS )
+			return( false );
 
 #if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
-		// Element Position Assertion.
-		assert( elementPos_ == elements.cend( ) && "Item::setElement - Element already added !" );
+		// Element Slot Assertion.
+		assert( elements[type_] == nullptr && "Item::setElement - Element already added !" );
 #else // !DEBUG
 		// Cancel, if Element found.
-		if ( elementPos_ != elements.cend( ) )
+		if ( elements[type_] != nullptr )
 			return( false );
 #endif // DEBUG
 
 		// Add Element.
-		elements.insert( pElement->type, pElement );
+		elements[type_] = pElement;
+		elementsMask |= 1u << type_;
 
 		// Return TRUE
 		return( true );
 
 	} /// Item::setElement
 
+	/**
+	  * Searches packed Extension.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pTag - Extension Tag.
+	  * @param pLength - Value Length output.
+	  * @return - Value offset, or -1 if not found.
+	  * @throws - no exceptions.
+	**/
+	int Item::findExtension( const RSSTag pTag, int & pLength ) const noexcept
+	{
+
+		// Packed data.
+		const QChar *const data_( extensions.constData( ) );
+		const int size_( extensions.size( ) );
+
+		// Search Extension.
+		for( int offset_ = 0; offset_ + 3 <= size_; )
+		{
+
+			// Value Length.
+			const int length_( static_cast<int>( data_[offset_ + 1].unicode( ) | ( static_cast<uint>( data_[offset_ + 2].unicode( ) ) << 16 ) ) );
+
+			// Found
+			if ( data_[offset_].unicode( ) == pTag )
+			{
+				pLength = length_;
+				return( offset_ + 3 );
+			}
+
+			// Next
+			offset_ += 3 + length_;
+
+		} /// Search Extension.
+
+		// Not found.
+		return( -1 );
+
+	} /// Item::findExtension
+
+	/**
+	  * Returns value of extension Element (<content:encoded>, <dc:creator>, <media:thumbnail url="">).
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pTag - Extension Tag.
+	  * @return - value, or null QString if not set.
+	  * @throws - no exceptions.
+	**/
+	QString Item::getExtension( const RSSTag pTag ) const noexcept
+	{
+
+		// Search Extension.
+		int length_( 0 );
+		const int offset_( findExtension( pTag, length_ ) );
+
+		// Return Value, or null.
+		return( offset_ < 0 ? QString( ) : QString( extensions.constData( ) + offset_, length_ ) );
+
+	} /// Item::getExtension
+
+	/**
+	  * Sets value of extension Element. First value kept.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pTag - Extension Tag.
+	  * @param pValue - value.
+	  * @return - 'true' if set, 'false' if already set.
+	  * @throws - no exceptions.
+	**/
+	bool Item::setExtension( const RSSTag pTag, const QString & pValue ) noexcept
+	{
+
+		// Cancel, if already set.
+		int length_( 0 );
+		if ( findExtension( pTag, length_ ) >= 0 )
+			return( false );
+
+		// Grow packed data to exact size.
+		const int offset_( extensions.size( ) );
+		const int valueLength_( pValue.size( ) );
+		extensions.resize( offset_ + 3 + valueLength_ );
+
+		// Write Header & Value.
+		QChar *const data_( extensions.data( ) + offset_ );
+		data_[0] = QChar( static_cast<ushort>( pTag ) );
+		data_[1] = QChar( static_cast<ushort>( static_cast<uint>( valueLength_ ) & 0xFFFFu ) );
+		data_[2] = QChar( static_cast<ushort>( static_cast<uint>( valueLength_ ) >> 16 ) );
+		const QChar *const value_( pValue.constData( ) );
+		for( int i = 0; i < valueLength_; i++ )
+			data_[3 + i] = value_[i];
+
+		// Return TRUE
+		return( true );
+
+	} /// Item::setExtension
+
 	/**
 	  * Checks if Item have newer date.
 	  *
 	  * @threadsafe - not thread-safe.
 	  * @param newItem - New-Item.
 	  * @param oldItem - Old-Item.
-	  * @returns - 'true' if new Item has newer date, or date-Elements not found.
+	  * @returns - 'true' if new Item has newer date, only new Item has date,
+	  * or neither Item has date (re-read Item without date replaces previous).
 	  * @throws - no exceptions.
 	**/
 	bool Item::isNewer( const rss::Item *const newItem, const rss::Item *const oldItem ) noexcept
@@ -175,37 +291,28 @@ namespace rss
 	void Item::releaseElements( ) noexcept
 	{
 
-		// Elements map Iterator.
-		auto elementsIter_ = elements.begin( );
-
-		// Elements map end-Iterator.
-		const auto elementsEndIter_ = elements.cend( );
-
-		// Element
-		element_ptr_t elementPtr( nullptr );
-
-		// Delete Elements
-		while( elementsIter_ != elementsEndIter_ )
+		// Delete set Elements, using mask.
+		quint32 mask_( elementsMask );
+		while( mask_ != 0 )
 		{
 
-			// Element
-			elementPtr = elementsIter_.value( );
+			// Lowest set slot.
+			const int slot_( static_cast<int>( qCountTrailingZeroBits( mask_ ) ) );
+			mask_ &= mask_ - 1;
 
 #if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
 			// Null-Check
-			Q_ASSERT( elementPtr != nullptr );
+			Q_ASSERT( elements[slot_] != nullptr );
 #endif // DEBUG
 
 			// Delete Element
-			delete elementPtr;
-
-			// Next Element
-			elementsIter_++;
+			delete elements[slot_];
+			elements[slot_] = nullptr;
 
-		} // Delete Elements
+		} // Delete set Elements
 
-		// Clear Elements collection (container).
-		elements.clear( );
+		// Clear mask.
+		elementsMask = 0;
 
 	} /// Item::releaseElements
 
@@ -217,7 +324,7 @@ namespace rss
 	  * @throws - no exceptions.
 	**/
 	bool Item::empty( ) const noexcept
-	{ return( elements.empty( ) ); }
+	{ return( elementsMask == 0 ); }
 
 	/**
 	  * Count sub-Elements.
@@ -227,7 +334,7 @@ namespace rss
 	  * @throws - no exceptions.
 	**/
 	int Item::count( ) const noexcept
-	{ return( elements.size( ) ); }
+	{ return( static_cast<int>( qPopulationCount( elementsMask ) ) ); }
 
 	// -----------------------------------------------------------
 
@@ -37,10 +37,15 @@
 #include <QString>
 #endif // !QSTRING_H
 
-// Include QMap
-#ifndef QMAP_H
-#include <QMap>
-#endif // !QMAP_H
+// Include QtGlobal
+#ifndef QGLOBAL_H
+#include <qglobal.h>
+#endif // !QGLOBAL_H
+
+// Include rss::RSSTags
+#ifndef QRSS_READER_RSS_TAGS_HPP
+#include "../utils/RSSTags.hpp"
+#endif // !QRSS_READER_RSS_TAGS_HPP
 
 // ===========================================================
 // Item
@@ -54,6 +59,8 @@ namespace rss
 	  *
 	  * @brief
 	  * Item contains sub-Elements, like <description>, <enclosure>, <guid>, etc.
+	  * Sub-Elements stored in fixed slots, indexed by ElementType,
+	  * so Element search is single load & Item has no per-Element nodes.
 	  *
 	  * @version 1.0
 	  * @since 21.07.2019
@@ -71,6 +78,13 @@ namespace rss
 		/** Alias for Element pointer. **/
 		using element_ptr_t = Element*;
 
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Number of Element slots, one per ElementType. **/
+		static constexpr int ELEMENT_SLOTS = ElementType::ITEM + 1;
+
 		// ===========================================================
 		// CONSTRUCTOR
 		// ===========================================================
@@ -127,11 +141,33 @@ namespace rss
 		  * @threadsafe - not thread-safe.
 		  * @param newItem - New-Item.
 		  * @param oldItem - Old-Item.
-		  * @returns - 'true' if new Item has newer date, or date-Elements not found.
+		  * @returns - 'true' if new Item has newer date, only new Item has date,
+		  * or neither Item has date (re-read Item without date replaces previous).
 		  * @throws - no exceptions.
 		**/
 		static bool isNewer( const rss::Item *const newItem, const rss::Item *const oldItem ) noexcept;
 
+		/**
+		  * Returns value of extension Element (<content:encoded>, <dc:creator>, <media:thumbnail url="">).
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pTag - Extension Tag.
+		  * @return - value, or null QString if not set.
+		  * @throws - no exceptions.
+		**/
+		QString getExtension( const RSSTag pTag ) const noexcept;
+
+		/**
+		  * Sets value of extension Element. First value kept.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pTag - Extension Tag.
+		  * @param pValue - value.
+		  * @return - 'true' if set, 'false' if already set.
+		  * @throws - no exceptions.
+		**/
+		bool setExtension( const RSSTag pTag, const QString & pValue ) noexcept;
+
 		// ===========================================================
 		// METHODS
 		// ===========================================================
@@ -172,8 +208,29 @@ namespace rss
 		// FIELDS
 		// ===========================================================
 
-		/** Elements. **/
-		QMap<ElementType, element_ptr_t> elements;
+		/** Elements, indexed by ElementType. Null if not set. **/
+		element_ptr_t elements[ELEMENT_SLOTS];
+
+		/** Set Elements bits (1 << ElementType). **/
+		quint32 elementsMask;
+
+		/**
+		  * Extensions, packed to one string (one allocation per Item):
+		  * [Tag][Length low 16 bits][Length high 16 bits][Value]...
+		  * Item has few Extensions, so linear search is used.
+		**/
+		QString extensions;
+
+		/**
+		  * Searches packed Extension.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pTag - Extension Tag.
+		  * @param pLength - Value Length output.
+		  * @return - Value offset, or -1 if not found.
+		  * @throws - no exceptions.
+		**/
+		int findExtension( const RSSTag pTag, int & pLength ) const noexcept;
 
 		// ===========================================================
 		// DELETED CONSTRUCTORS & OPERATORS
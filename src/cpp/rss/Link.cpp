@@ -29,6 +29,11 @@
 #include "Link.hpp"
 #endif // !QRSS_READER_LINK_HPP
 
+// Include rss::ElementPool
+#ifndef QRSS_READER_ELEMENT_POOL_HPP
+#include "../utils/ElementPool.hpp"
+#endif // !QRSS_READER_ELEMENT_POOL_HPP
+
 // ===========================================================
 // LINK
 // ===========================================================
@@ -67,6 +72,31 @@ namespace rss
 	**/
 	Link::~Link( ) noexcept = default;
 
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Allocates Link from Channel Arena, bound to calling thread, or Links pool.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pSize - Link size.
+	  * @return - memory.
+	  * @throws - std::bad_alloc.
+	**/
+	void * Link::operator new( size_t pSize )
+	{ return( ElementPool<Link>::allocate( pSize ) ); }
+
+	/**
+	  * Releases Link memory to Links pool. Memory of Arena Link freed with Arena.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pMemory - memory.
+	  * @throws - no exceptions.
+	**/
+	void Link::operator delete( void * pMemory ) noexcept
+	{ ElementPool<Link>::release( pMemory ); }
+
 	// -----------------------------------------------------------
 
 } // rss
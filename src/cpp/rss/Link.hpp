@@ -96,6 +96,29 @@ namespace rss
 		**/
 		virtual ~Link( ) noexcept final;
 
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Allocates Link from Channel Arena, bound to calling thread, or Links pool.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pSize - Link size.
+		  * @return - memory.
+		  * @throws - std::bad_alloc.
+		**/
+		static void * operator new( size_t pSize );
+
+		/**
+		  * Releases Link memory to Links pool. Memory of Arena Link freed with Arena.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pMemory - memory.
+		  * @throws - no exceptions.
+		**/
+		static void operator delete( void * pMemory ) noexcept;
+
 		// -----------------------------------------------------------
 
 	private:
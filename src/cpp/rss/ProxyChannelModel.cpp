@@ -144,35 +144,60 @@ namespace rss
 	void ProxyChannelModel::onUpdateItemsList( ) noexcept
 	{
 
-		// Reset Items List.
+		// Reset Items List & Rows-Map.
 		mItems.clear( );
+		mRowsMap.clear( );
 
-		// Count Channel' Items.
-		const int itemsCount_( mSelectedChannel->countItems( ) );
+		// Channel' Items rows, sorted by Channel columns (newest first).
+		QVector<int> rows_;
+		mSelectedChannel->getItemRows( 0, rows_ );
+		const int itemsCount_( rows_.size( ) );
 
 		// Channel' Item.
 		rss::Item * item_( nullptr );
 
-		// Filter Items.
+		// Reserve Items List.
+		mItems.reserve( itemsCount_ );
+
+		// Add sorted Items.
 		for( int i = 0; i < itemsCount_; i++ )
 		{
 
-			// Get Item.
-			item_ = mSelectedChannel->getItem( i );
+			// Get Item, null if not loaded yet.
+			item_ = mSelectedChannel->getItem( rows_.at( i ) );
 
-			// Skip, if Item removed.
-			if ( item_ == nullptr )
-				continue;
-
-			// Add Item to List.
+			// Add Item to List. Not loaded Items loaded by #index, when Views request them.
 			mItems.push_back( item_ );
 
-		} /// Filter Items.
+			// Map moved Row.
+			if ( rows_.at( i ) != i )
+				mRowsMap.insert( i, rows_.at( i ) );
 
-		// Sort Items.
+		} /// Add sorted Items.
 
 	} /// ProxyChannelModel::onUpdateItemsList
 
+	/**
+	  * Called when source-Model changes Items rows, or deletes replaced Items.
+	  * Items List built again, so stale rows & retired Items not used.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void ProxyChannelModel::onItemsChanged( ) noexcept
+	{
+
+		// Cancel, if no Channel selected.
+		if ( mSelectedChannel == nullptr )
+			return;
+
+		// Notify Views, Items List replaced.
+		beginResetModel( );
+		onUpdateItemsList( );
+		endResetModel( );
+
+	} /// ProxyChannelModel::onItemsChanged
+
 	// ===========================================================
 	// QML Methods
 	// ===========================================================
@@ -249,6 +274,35 @@ namespace rss
 
 	} /// ProxyChannelModel::filterAcceptsRow
 
+	/**
+	  * Sets source-Model (ChannelModel).
+	  *
+	  * (?) Connects #onItemsChanged to ChannelModel#itemsChanged & ChannelModel#itemsRetired.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pModel - ChannelModel.
+	  * @throws - no exceptions.
+	**/
+	void ProxyChannelModel::setSourceModel( QAbstractItemModel * pModel )
+	{
+
+		// Disconnect previous source-Model.
+		if ( sourceModel( ) != nullptr )
+			disconnect( sourceModel( ), nullptr, this, nullptr );
+
+		// Set source-Model.
+		QSortFilterProxyModel::setSourceModel( pModel );
+
+		// Read changed Items rows, drop retired Items before ChannelModel deletes them.
+		rss::ChannelModel *const channelModel_( static_cast<rss::ChannelModel*>( pModel ) );
+		if ( channelModel_ != nullptr )
+		{
+			connect( channelModel_, &rss::ChannelModel::itemsChanged, this, &ProxyChannelModel::onItemsChanged );
+			connect( channelModel_, &rss::ChannelModel::itemsRetired, this, &ProxyChannelModel::onItemsChanged );
+		}
+
+	} /// ProxyChannelModel::setSourceModel
+
 	/**
 	  * Retrieves data (text, image, date, url, etc) using src-ModelIndex.
 	  *
@@ -407,8 +461,24 @@ namespace rss
 		if ( pRow < 0 || pCol < 0 || mSelectedChannel == nullptr )
 			return( QModelIndex( ) );
 
-		// Get Channel' Item using rows-mapping.
-		rss::Item *const item_( mItems.at( pRow ) );
+		// Cancel, if out-of-range.
+		if ( pRow >= mItems.size( ) )
+			return( QModelIndex( ) );
+
+		// Get Channel' Item, load it if only indexed.
+		rss::Item * item_( mItems.at( pRow ) );
+		if ( item_ == nullptr )
+		{
+
+			item_ = rss::ChannelModel::loadItem( mSelectedChannel, getSourceRow( pRow ) );
+
+			// Cancel, if File changed since indexed. Channel indexed again, when File read.
+			if ( item_ == nullptr )
+				return( QModelIndex( ) );
+
+			mItems[pRow] = item_;
+
+		}
 
 #if defined( QT_DEBUG ) // DEBUG
 		// Check Channel' Item.
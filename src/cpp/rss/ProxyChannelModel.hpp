@@ -127,8 +127,9 @@ namespace rss
 
 		/**
 		  * Filtered & sorted Channel' Items List (vector).
+		  * Null for Item not loaded yet, loaded by #index.
 		**/
-		QVector<rss::Item*> mItems;
+		mutable QVector<rss::Item*> mItems;
 
 		// -----------------------------------------------------------
 
@@ -225,6 +226,15 @@ namespace rss
 		**/
 		void onUpdateItemsList( ) noexcept;
 
+		/**
+		  * Called when source-Model changes Items rows, or deletes replaced Items.
+		  * Items List built again, so stale rows & retired Items not used.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		void onItemsChanged( ) noexcept;
+
 		// ===========================================================
 		// OVERRIDE: QSortFilterProxyModel
 		// ===========================================================
@@ -240,6 +250,17 @@ namespace rss
 		**/
 		bool filterAcceptsRow( int srcRow, const QModelIndex & srcIndex ) const override;
 
+		/**
+		  * Sets source-Model (ChannelModel).
+		  *
+		  * (?) Connects #onItemsChanged to ChannelModel#itemsChanged & ChannelModel#itemsRetired.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pModel - ChannelModel.
+		  * @throws - no exceptions.
+		**/
+		virtual void setSourceModel( QAbstractItemModel * pModel ) override;
+
 		/**
 		  * Retrieves data (text, image, date, url, etc) using src-ModelIndex.
 		  *
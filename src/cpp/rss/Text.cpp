@@ -29,6 +29,31 @@
 #include "Text.hpp"
 #endif // !QRSS_READER_TEXT_HPP
 
+// Include rss::CharsetDecoder
+#ifndef QRSS_READER_CHARSET_DECODER_HPP
+#include "../utils/CharsetDecoder.hpp"
+#endif // !QRSS_READER_CHARSET_DECODER_HPP
+
+// Include rss::ElementPool
+#ifndef QRSS_READER_ELEMENT_POOL_HPP
+#include "../utils/ElementPool.hpp"
+#endif // !QRSS_READER_ELEMENT_POOL_HPP
+
+// Include QCache
+#ifndef QCACHE_H
+#include <QCache>
+#endif // !QCACHE_H
+
+// Include QMutex
+#ifndef QMUTEX_H
+#include <QMutex>
+#endif // !QMUTEX_H
+
+// Include QPair
+#ifndef QPAIR_H
+#include <QPair>
+#endif // !QPAIR_H
+
 // ===========================================================
 // TEXT
 // ===========================================================
@@ -38,6 +63,179 @@ namespace rss
 
 	// -----------------------------------------------------------
 
+	namespace
+	{
+
+		/** Max. number of cached characters. **/
+		constexpr int CACHE_CAPACITY = 512 * 1024;
+
+		/** Cache key: Text & 'true' if HTML stripped. **/
+		using cache_key_t = QPair<const Text*, bool>;
+
+		/** Decoded-Text LRU cache, shared by all Texts. **/
+		struct DecodedCache final
+		{
+
+			/** Thread-Lock. **/
+			QMutex mMutex;
+
+			/** Decoded Texts, cost is number of characters. **/
+			QCache<cache_key_t, QString> mTexts;
+
+			/** DecodedCache constructor. **/
+			DecodedCache( ) noexcept
+				: mMutex( ),
+				  mTexts( CACHE_CAPACITY )
+			{
+			}
+
+		}; /// DecodedCache
+
+		/**
+		  * Returns decoded-Text cache.
+		  *
+		  * @return - DecodedCache.
+		**/
+		DecodedCache & getCache( ) noexcept
+		{
+
+			// Created on first use.
+			static DecodedCache cache_;
+
+			// Return cache.
+			return( cache_ );
+
+		}
+
+		/** HTML entities, which feeds use most. **/
+		const struct { const char * mName; ushort mCode; } HTML_ENTITIES[] =
+		{
+			{ "amp", '&' },
+			{ "lt", '<' },
+			{ "gt", '>' },
+			{ "quot", '"' },
+			{ "apos", '\'' },
+			{ "nbsp", ' ' },
+			{ "ndash", 0x2013 },
+			{ "mdash", 0x2014 },
+			{ "lsquo", 0x2018 },
+			{ "rsquo", 0x2019 },
+			{ "ldquo", 0x201C },
+			{ "rdquo", 0x201D },
+			{ "laquo", 0x00AB },
+			{ "raquo", 0x00BB },
+			{ "hellip", 0x2026 },
+			{ "bull", 0x2022 },
+			{ "copy", 0x00A9 },
+			{ "reg", 0x00AE },
+			{ "trade", 0x2122 },
+			{ "euro", 0x20AC }
+		};
+
+		/**
+		  * Decodes HTML entity (&nbsp;, &#160;, &#xA0;).
+		  *
+		  * @param pFrom - '&' position, moved after ';' if entity decoded.
+		  * @param pTo - end of Text.
+		  * @param pOut - output.
+		  * @return - 'true' if decoded, 'false' if '&' is plain character.
+		**/
+		bool decodeHtmlEntity( const QChar *& pFrom, const QChar *const pTo, QString & pOut ) noexcept
+		{
+
+			// Name start.
+			const QChar *const name_( pFrom + 1 );
+
+			// Search ';', entities are short.
+			const QChar * end_( name_ );
+			while( end_ < pTo && end_ - name_ < 10 && *end_ != QLatin1Char( ';' ) )
+				end_++;
+
+			// Cancel, if not terminated.
+			if ( end_ >= pTo || *end_ != QLatin1Char( ';' ) || end_ == name_ )
+				return( false );
+
+			// Name
+			const QString entity_( name_, static_cast<int>( end_ - name_ ) );
+
+			// Character code.
+			uint code_( 0 );
+
+			// Character reference.
+			if ( entity_.size( ) > 1 && entity_[0] == QLatin1Char( '#' ) )
+			{
+
+				// Hexadecimal
+				const bool hex_( entity_[1] == QLatin1Char( 'x' ) || entity_[1] == QLatin1Char( 'X' ) );
+
+				// Read number.
+				bool ok_( false );
+				code_ = entity_.mid( hex_ ? 2 : 1 ).toUInt( &ok_, hex_ ? 16 : 10 );
+				if ( !ok_ || code_ == 0 || code_ > 0x10FFFFu || ( code_ >= 0xD800u && code_ <= 0xDFFFu ) )
+					return( false );
+
+			} /// Character reference.
+			else
+			{ // Named entity.
+
+				// Search entity.
+				for( const auto & htmlEntity_ : HTML_ENTITIES )
+				{
+					if ( entity_ == QLatin1String( htmlEntity_.mName ) )
+					{
+						code_ = htmlEntity_.mCode;
+						break;
+					}
+				}
+
+				// Unknown entity kept as is.
+				if ( code_ == 0 )
+					return( false );
+
+			} /// Named entity.
+
+			// Add character.
+			if ( QChar::requiresSurrogates( code_ ) )
+			{
+				pOut.append( QChar( QChar::highSurrogate( code_ ) ) );
+				pOut.append( QChar( QChar::lowSurrogate( code_ ) ) );
+			}
+			else
+				pOut.append( QChar( static_cast<ushort>( code_ ) ) );
+
+			// Move after ';'.
+			pFrom = end_ + 1;
+
+			// Return TRUE
+			return( true );
+
+		}
+
+		/**
+		  * Checks that Text starts with ASCII prefix, ignoring case.
+		  *
+		  * @param pFrom - first character.
+		  * @param pTo - end of Text.
+		  * @param pPrefix - lower-case prefix.
+		  * @return - 'true' if Text starts with prefix.
+		**/
+		bool startsWithIgnoreCase( const QChar * pFrom, const QChar *const pTo, const char * pPrefix ) noexcept
+		{
+
+			// Compare characters.
+			for( ; *pPrefix != '\0'; pFrom++, pPrefix++ )
+			{
+				if ( pFrom >= pTo || pFrom->toLower( ) != QLatin1Char( *pPrefix ) )
+					return( false );
+			}
+
+			// Return TRUE
+			return( true );
+
+		}
+
+	} // namespace
+
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -52,7 +250,28 @@ namespace rss
 	**/
 	Text::Text( const QString & pData, Element *const parentElement, const Element::Type pType ) noexcept
 		: Element( pType, parentElement ),
-		  mData( pData )
+		  mData( pData ),
+		  mRaw( ),
+		  mCharset( nullptr ),
+		  mCached( false )
+	{
+	}
+
+	/**
+	  * Text constructor, raw Text decoded on first use.
+	  *
+	  * @param pRaw - Element content bytes: Text (with entities), CDATA sections & comments.
+	  * @param pCharset - table of single-byte charset (rss::CharsetDecoder), null for UTF-8.
+	  * @param parentElement - Parent-Element.
+	  * @param pType - Emelent-Type (Description).
+	  * @throws - no exceptions.
+	**/
+	Text::Text( const QByteArray & pRaw, const ushort *const pCharset, Element *const parentElement, const Element::Type pType ) noexcept
+		: Element( pType, parentElement ),
+		  mData( ),
+		  mRaw( pRaw ),
+		  mCharset( pCharset ),
+		  mCached( false )
 	{
 	}
 
@@ -65,7 +284,241 @@ namespace rss
 	  *
 	  * @throws - no exceptions.
 	**/
-	Text::~Text( ) noexcept = default;
+	Text::~Text( ) noexcept
+	{
+
+		// Cancel, if not cached.
+		if ( !mCached )
+			return;
+
+		// Decoded-Text cache.
+		DecodedCache & cache_( getCache( ) );
+
+		// Thread-Lock
+		QMutexLocker uLock( &cache_.mMutex );
+
+		// Remove decoded Texts, Text pointer can be reused.
+		cache_.mTexts.remove( cache_key_t( this, false ) );
+		cache_.mTexts.remove( cache_key_t( this, true ) );
+
+	}
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Decodes raw Text.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @return - Text.
+	  * @throws - no exceptions.
+	**/
+	QString Text::decodeRaw( ) const noexcept
+	{
+
+		// Characters, never more than bytes.
+		QString result_( mRaw.size( ), Qt::Uninitialized );
+
+		// Decode Text & CDATA sections.
+		const int length_( CharsetDecoder::decodeContent( mRaw.constData( ), mRaw.constData( ) + mRaw.size( ), mCharset, result_.data( ) ) );
+
+		// Bytes, not checked by Scanner, invalid: decode as UTF-8 with replacement characters.
+		if ( length_ < 0 )
+			return( QString::fromUtf8( mRaw ) );
+
+		// Cut unused characters.
+		result_.truncate( length_ );
+
+		// Return Text.
+		return( result_ );
+
+	} /// Text::decodeRaw
+
+	/**
+	  * Returns Text. Raw Text decoded & cached.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pStripHtml - 'true' to remove HTML tags, decode HTML entities & collapse white-spaces.
+	  * @return - Text.
+	  * @throws - no exceptions.
+	**/
+	QString Text::getData( const bool pStripHtml ) const noexcept
+	{
+
+		// Decoded by parser.
+		if ( mRaw.isNull( ) && !pStripHtml )
+			return( mData );
+
+		// Decoded-Text cache.
+		DecodedCache & cache_( getCache( ) );
+
+		// Cache key.
+		const cache_key_t key_( this, pStripHtml );
+
+		// Search decoded Text.
+		{
+
+			// Thread-Lock
+			QMutexLocker uLock( &cache_.mMutex );
+
+			// Return cached Text.
+			const QString *const cached_( cache_.mTexts.object( key_ ) );
+			if ( cached_ != nullptr )
+				return( *cached_ );
+
+		} /// Search decoded Text.
+
+		// Decode
+		QString result_( mRaw.isNull( ) ? mData : decodeRaw( ) );
+
+		// Strip HTML.
+		if ( pStripHtml )
+			result_ = stripHtml( result_ );
+
+		// Add to cache.
+		{
+
+			// Thread-Lock
+			QMutexLocker uLock( &cache_.mMutex );
+
+			// Add, least recently used Texts removed.
+			mCached = true;
+			cache_.mTexts.insert( key_, new QString( result_ ), result_.size( ) + 1 );
+
+		} /// Add to cache.
+
+		// Return Text.
+		return( result_ );
+
+	} /// Text::getData
+
+	/**
+	  * Returns 'true' if raw Text kept, not decoded yet.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool Text::isRaw( ) const noexcept
+	{ return( !mRaw.isNull( ) ); }
+
+	/**
+	  * Removes HTML tags (<script> & <style> with content), decodes HTML entities
+	  * & collapses white-spaces.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pHtml - HTML.
+	  * @return - plain Text.
+	  * @throws - no exceptions.
+	**/
+	QString Text::stripHtml( const QString & pHtml ) noexcept
+	{
+
+		// Plain Text, never longer than HTML.
+		QString result_;
+		result_.reserve( pHtml.size( ) );
+
+		// Characters.
+		const QChar * pos_( pHtml.constData( ) );
+		const QChar *const end_( pos_ + pHtml.size( ) );
+
+		// 'true' after white-space, leading white-spaces skipped.
+		bool space_( true );
+
+		// Read HTML.
+		while( pos_ < end_ )
+		{
+
+			// Tag, replaced with white-space.
+			if ( *pos_ == QLatin1Char( '<' ) )
+			{
+
+				// Content of <script> & <style> skipped.
+				const char *const closeTag_( startsWithIgnoreCase( pos_ + 1, end_, "script" ) ? "</script" : startsWithIgnoreCase( pos_ + 1, end_, "style" ) ? "</style" : nullptr );
+				if ( closeTag_ != nullptr )
+				{
+					while( pos_ < end_ && !startsWithIgnoreCase( pos_, end_, closeTag_ ) )
+						pos_++;
+				}
+
+				// Skip tag.
+				while( pos_ < end_ && *pos_ != QLatin1Char( '>' ) )
+					pos_++;
+				if ( pos_ < end_ )
+					pos_++;
+
+				// Separate words of adjacent blocks.
+				if ( !space_ )
+				{
+					result_.append( QLatin1Char( ' ' ) );
+					space_ = true;
+				}
+
+				// Next
+				continue;
+
+			} /// Tag, replaced with white-space.
+
+			// White-spaces collapsed.
+			if ( pos_->isSpace( ) )
+			{
+
+				// Add one white-space.
+				if ( !space_ )
+				{
+					result_.append( QLatin1Char( ' ' ) );
+					space_ = true;
+				}
+
+				// Next
+				pos_++;
+				continue;
+
+			} /// White-spaces collapsed.
+
+			// Entity
+			if ( *pos_ == QLatin1Char( '&' ) && decodeHtmlEntity( pos_, end_, result_ ) )
+			{
+				space_ = false;
+				continue;
+			}
+
+			// Character
+			result_.append( *pos_ );
+			space_ = false;
+			pos_++;
+
+		} /// Read HTML.
+
+		// Remove trailing white-space.
+		if ( space_ && !result_.isEmpty( ) )
+			result_.chop( 1 );
+
+		// Return plain Text.
+		return( result_ );
+
+	} /// Text::stripHtml
+
+	/**
+	  * Allocates Text from Channel Arena, bound to calling thread, or Texts pool.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pSize - Text size.
+	  * @return - memory.
+	  * @throws - std::bad_alloc.
+	**/
+	void * Text::operator new( size_t pSize )
+	{ return( ElementPool<Text>::allocate( pSize ) ); }
+
+	/**
+	  * Releases Text memory to Texts pool. Memory of Arena Text freed with Arena.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pMemory - memory.
+	  * @throws - no exceptions.
+	**/
+	void Text::operator delete( void * pMemory ) noexcept
+	{ ElementPool<Text>::release( pMemory ); }
 
 	// -----------------------------------------------------------
 
@@ -37,6 +37,11 @@
 #include <QString>
 #endif // !QSTRING_H
 
+// Include QByteArray
+#ifndef QBYTEARRAY_H
+#include <QByteArray>
+#endif // !QBYTEARRAY_H
+
 // ===========================================================
 // TEXT
 // ===========================================================
@@ -51,6 +56,8 @@ namespace rss
 	  *
 	  * @brief
 	  * Text - alias for description, author, etc.
+	  * Item Description can be kept raw (escaped bytes & CDATA, as in document),
+	  * it's decoded on first #getData & cached (LRU, shared by all Texts).
 	  *
 	  * @version 1.0
 	  * @since 21.07.2019
@@ -65,7 +72,7 @@ namespace rss
 		// CONSTANTS
 		// ===========================================================
 
-		/** Text. **/
+		/** Text. Empty, if raw Text kept (use #getData). **/
 		const QString mData;
 
 		// ===========================================================
@@ -82,6 +89,17 @@ namespace rss
 		**/
 		explicit Text( const QString & pData, Element *const parentElement, const Element::Type pType = Element::Type::DESCRITION ) noexcept;
 
+		/**
+		  * Text constructor, raw Text decoded on first use.
+		  *
+		  * @param pRaw - Element content bytes: Text (with entities), CDATA sections & comments.
+		  * @param pCharset - table of single-byte charset (rss::CharsetDecoder), null for UTF-8.
+		  * @param parentElement - Parent-Element.
+		  * @param pType - Emelent-Type (Description).
+		  * @throws - no exceptions.
+		**/
+		explicit Text( const QByteArray & pRaw, const ushort *const pCharset, Element *const parentElement, const Element::Type pType = Element::Type::DESCRITION ) noexcept;
+
 		// ===========================================================
 		// DESTRUCTOR
 		// ===========================================================
@@ -93,12 +111,90 @@ namespace rss
 		**/
 		virtual ~Text( ) noexcept final;
 
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Returns Text. Raw Text decoded & cached.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pStripHtml - 'true' to remove HTML tags, decode HTML entities & collapse white-spaces.
+		  * @return - Text.
+		  * @throws - no exceptions.
+		**/
+		QString getData( const bool pStripHtml = false ) const noexcept;
+
+		/**
+		  * Returns 'true' if raw Text kept, not decoded yet.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @throws - no exceptions.
+		**/
+		bool isRaw( ) const noexcept;
+
+		/**
+		  * Removes HTML tags (<script> & <style> with content), decodes HTML entities
+		  * & collapses white-spaces.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pHtml - HTML.
+		  * @return - plain Text.
+		  * @throws - no exceptions.
+		**/
+		static QString stripHtml( const QString & pHtml ) noexcept;
+
+		/**
+		  * Allocates Text from Channel Arena, bound to calling thread, or Texts pool.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pSize - Text size.
+		  * @return - memory.
+		  * @throws - std::bad_alloc.
+		**/
+		static void * operator new( size_t pSize );
+
+		/**
+		  * Releases Text memory to Texts pool. Memory of Arena Text freed with Arena.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pMemory - memory.
+		  * @throws - no exceptions.
+		**/
+		static void operator delete( void * pMemory ) noexcept;
+
 		// -----------------------------------------------------------
 
 	private:
 
 		// -----------------------------------------------------------
 
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Raw Element content, null if Text decoded by parser. **/
+		const QByteArray mRaw;
+
+		/** Table of single-byte charset of raw Text, null for UTF-8. **/
+		const ushort *const mCharset;
+
+		/** 'true' if Text added to decoded-Text cache. **/
+		mutable bool mCached;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Decodes raw Text.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @return - Text.
+		  * @throws - no exceptions.
+		**/
+		QString decodeRaw( ) const noexcept;
+
 		// ===========================================================
 		// DELETED CONSTRUCTORS & OPERATORS
 		// ===========================================================
@@ -0,0 +1,984 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef QRSS_READER_CHARSET_DECODER_HPP
+#include "CharsetDecoder.hpp"
+#endif // !QRSS_READER_CHARSET_DECODER_HPP
+
+// Include C++ string functions (strcmp, strncmp, memchr).
+#include <cstring>
+
+// SIMD
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define QRSS_READER_CHARSET_DECODER_SSE2
+#include <emmintrin.h>
+#endif // SSE2
+
+#if defined( _MSC_VER )
+#include <intrin.h> // _BitScanForward
+#endif // MSVC
+
+// ===========================================================
+// rss::CharsetDecoder
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	namespace
+	{
+
+		/** Max. length of encoding name. **/
+		constexpr int MAX_NAME_LENGTH = 32;
+
+		/** windows-1251, bytes 0x80-0xFF. **/
+		const ushort WINDOWS_1251_TABLE[128] =
+		{
+			0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021,
+			0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+			0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+			0x0000, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+			0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7,
+			0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+			0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7,
+			0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+			0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+			0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+			0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+			0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+			0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+			0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+			0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+			0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F
+		};
+
+		/** koi8-r, bytes 0x80-0xFF. **/
+		const ushort KOI8_R_TABLE[128] =
+		{
+			0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524,
+			0x252C, 0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x258C, 0x2590,
+			0x2591, 0x2592, 0x2593, 0x2320, 0x25A0, 0x2219, 0x221A, 0x2248,
+			0x2264, 0x2265, 0x00A0, 0x2321, 0x00B0, 0x00B2, 0x00B7, 0x00F7,
+			0x2550, 0x2551, 0x2552, 0x0451, 0x2553, 0x2554, 0x2555, 0x2556,
+			0x2557, 0x2558, 0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E,
+			0x255F, 0x2560, 0x2561, 0x0401, 0x2562, 0x2563, 0x2564, 0x2565,
+			0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x256B, 0x256C, 0x00A9,
+			0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+			0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+			0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+			0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A,
+			0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+			0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+			0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+			0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A
+		};
+
+		/** iso-8859-1, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_1_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+			0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+			0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+			0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+			0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+			0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+			0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+			0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+			0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+			0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
+		};
+
+		/** iso-8859-2, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_2_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0104, 0x02D8, 0x0141, 0x00A4, 0x013D, 0x015A, 0x00A7,
+			0x00A8, 0x0160, 0x015E, 0x0164, 0x0179, 0x00AD, 0x017D, 0x017B,
+			0x00B0, 0x0105, 0x02DB, 0x0142, 0x00B4, 0x013E, 0x015B, 0x02C7,
+			0x00B8, 0x0161, 0x015F, 0x0165, 0x017A, 0x02DD, 0x017E, 0x017C,
+			0x0154, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0139, 0x0106, 0x00C7,
+			0x010C, 0x00C9, 0x0118, 0x00CB, 0x011A, 0x00CD, 0x00CE, 0x010E,
+			0x0110, 0x0143, 0x0147, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x00D7,
+			0x0158, 0x016E, 0x00DA, 0x0170, 0x00DC, 0x00DD, 0x0162, 0x00DF,
+			0x0155, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x013A, 0x0107, 0x00E7,
+			0x010D, 0x00E9, 0x0119, 0x00EB, 0x011B, 0x00ED, 0x00EE, 0x010F,
+			0x0111, 0x0144, 0x0148, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x00F7,
+			0x0159, 0x016F, 0x00FA, 0x0171, 0x00FC, 0x00FD, 0x0163, 0x02D9
+		};
+
+		/** iso-8859-3, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_3_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0126, 0x02D8, 0x00A3, 0x00A4, 0x0000, 0x0124, 0x00A7,
+			0x00A8, 0x0130, 0x015E, 0x011E, 0x0134, 0x00AD, 0x0000, 0x017B,
+			0x00B0, 0x0127, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x0125, 0x00B7,
+			0x00B8, 0x0131, 0x015F, 0x011F, 0x0135, 0x00BD, 0x0000, 0x017C,
+			0x00C0, 0x00C1, 0x00C2, 0x0000, 0x00C4, 0x010A, 0x0108, 0x00C7,
+			0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+			0x0000, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x0120, 0x00D6, 0x00D7,
+			0x011C, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x016C, 0x015C, 0x00DF,
+			0x00E0, 0x00E1, 0x00E2, 0x0000, 0x00E4, 0x010B, 0x0109, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x0000, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x0121, 0x00F6, 0x00F7,
+			0x011D, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x016D, 0x015D, 0x02D9
+		};
+
+		/** iso-8859-4, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_4_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0104, 0x0138, 0x0156, 0x00A4, 0x0128, 0x013B, 0x00A7,
+			0x00A8, 0x0160, 0x0112, 0x0122, 0x0166, 0x00AD, 0x017D, 0x00AF,
+			0x00B0, 0x0105, 0x02DB, 0x0157, 0x00B4, 0x0129, 0x013C, 0x02C7,
+			0x00B8, 0x0161, 0x0113, 0x0123, 0x0167, 0x014A, 0x017E, 0x014B,
+			0x0100, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x012E,
+			0x010C, 0x00C9, 0x0118, 0x00CB, 0x0116, 0x00CD, 0x00CE, 0x012A,
+			0x0110, 0x0145, 0x014C, 0x0136, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+			0x00D8, 0x0172, 0x00DA, 0x00DB, 0x00DC, 0x0168, 0x016A, 0x00DF,
+			0x0101, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x012F,
+			0x010D, 0x00E9, 0x0119, 0x00EB, 0x0117, 0x00ED, 0x00EE, 0x012B,
+			0x0111, 0x0146, 0x014D, 0x0137, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+			0x00F8, 0x0173, 0x00FA, 0x00FB, 0x00FC, 0x0169, 0x016B, 0x02D9
+		};
+
+		/** iso-8859-5, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_5_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407,
+			0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x00AD, 0x040E, 0x040F,
+			0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+			0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+			0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+			0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+			0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+			0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+			0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+			0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+			0x2116, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+			0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x00A7, 0x045E, 0x045F
+		};
+
+		/** iso-8859-6, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_6_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0000, 0x0000, 0x0000, 0x00A4, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x060C, 0x00AD, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x061B, 0x0000, 0x0000, 0x0000, 0x061F,
+			0x0000, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627,
+			0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+			0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637,
+			0x0638, 0x0639, 0x063A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647,
+			0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F,
+			0x0650, 0x0651, 0x0652, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+		};
+
+		/** iso-8859-7, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_7_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x2018, 0x2019, 0x00A3, 0x20AC, 0x20AF, 0x00A6, 0x00A7,
+			0x00A8, 0x00A9, 0x037A, 0x00AB, 0x00AC, 0x00AD, 0x0000, 0x2015,
+			0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x0384, 0x0385, 0x0386, 0x00B7,
+			0x0388, 0x0389, 0x038A, 0x00BB, 0x038C, 0x00BD, 0x038E, 0x038F,
+			0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+			0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+			0x03A0, 0x03A1, 0x0000, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7,
+			0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+			0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+			0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+			0x03C0, 0x03C1, 0x03C2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+			0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x0000
+		};
+
+		/** iso-8859-8, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_8_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0000, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+			0x00A8, 0x00A9, 0x00D7, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+			0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+			0x00B8, 0x00B9, 0x00F7, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+			0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2017,
+			0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7,
+			0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+			0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7,
+			0x05E8, 0x05E9, 0x05EA, 0x0000, 0x0000, 0x200E, 0x200F, 0x0000
+		};
+
+		/** iso-8859-9, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_9_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+			0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+			0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+			0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+			0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+			0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+			0x011E, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+			0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0130, 0x015E, 0x00DF,
+			0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x011F, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+			0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0131, 0x015F, 0x00FF
+		};
+
+		/** iso-8859-10, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_10_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0104, 0x0112, 0x0122, 0x012A, 0x0128, 0x0136, 0x00A7,
+			0x013B, 0x0110, 0x0160, 0x0166, 0x017D, 0x00AD, 0x016A, 0x014A,
+			0x00B0, 0x0105, 0x0113, 0x0123, 0x012B, 0x0129, 0x0137, 0x00B7,
+			0x013C, 0x0111, 0x0161, 0x0167, 0x017E, 0x2015, 0x016B, 0x014B,
+			0x0100, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x012E,
+			0x010C, 0x00C9, 0x0118, 0x00CB, 0x0116, 0x00CD, 0x00CE, 0x00CF,
+			0x00D0, 0x0145, 0x014C, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x0168,
+			0x00D8, 0x0172, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+			0x0101, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x012F,
+			0x010D, 0x00E9, 0x0119, 0x00EB, 0x0117, 0x00ED, 0x00EE, 0x00EF,
+			0x00F0, 0x0146, 0x014D, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x0169,
+			0x00F8, 0x0173, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x0138
+		};
+
+		/** iso-8859-11, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_11_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07,
+			0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+			0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17,
+			0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F,
+			0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27,
+			0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F,
+			0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37,
+			0x0E38, 0x0E39, 0x0E3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E3F,
+			0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47,
+			0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0E4E, 0x0E4F,
+			0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57,
+			0x0E58, 0x0E59, 0x0E5A, 0x0E5B, 0x0000, 0x0000, 0x0000, 0x0000
+		};
+
+		/** iso-8859-13, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_13_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x201D, 0x00A2, 0x00A3, 0x00A4, 0x201E, 0x00A6, 0x00A7,
+			0x00D8, 0x00A9, 0x0156, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00C6,
+			0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x201C, 0x00B5, 0x00B6, 0x00B7,
+			0x00F8, 0x00B9, 0x0157, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00E6,
+			0x0104, 0x012E, 0x0100, 0x0106, 0x00C4, 0x00C5, 0x0118, 0x0112,
+			0x010C, 0x00C9, 0x0179, 0x0116, 0x0122, 0x0136, 0x012A, 0x013B,
+			0x0160, 0x0143, 0x0145, 0x00D3, 0x014C, 0x00D5, 0x00D6, 0x00D7,
+			0x0172, 0x0141, 0x015A, 0x016A, 0x00DC, 0x017B, 0x017D, 0x00DF,
+			0x0105, 0x012F, 0x0101, 0x0107, 0x00E4, 0x00E5, 0x0119, 0x0113,
+			0x010D, 0x00E9, 0x017A, 0x0117, 0x0123, 0x0137, 0x012B, 0x013C,
+			0x0161, 0x0144, 0x0146, 0x00F3, 0x014D, 0x00F5, 0x00F6, 0x00F7,
+			0x0173, 0x0142, 0x015B, 0x016B, 0x00FC, 0x017C, 0x017E, 0x2019
+		};
+
+		/** iso-8859-14, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_14_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x1E02, 0x1E03, 0x00A3, 0x010A, 0x010B, 0x1E0A, 0x00A7,
+			0x1E80, 0x00A9, 0x1E82, 0x1E0B, 0x1EF2, 0x00AD, 0x00AE, 0x0178,
+			0x1E1E, 0x1E1F, 0x0120, 0x0121, 0x1E40, 0x1E41, 0x00B6, 0x1E56,
+			0x1E81, 0x1E57, 0x1E83, 0x1E60, 0x1EF3, 0x1E84, 0x1E85, 0x1E61,
+			0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+			0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+			0x0174, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x1E6A,
+			0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x0176, 0x00DF,
+			0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x0175, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x1E6B,
+			0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x0177, 0x00FF
+		};
+
+		/** iso-8859-15, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_15_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AC, 0x00A5, 0x0160, 0x00A7,
+			0x0161, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+			0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x017D, 0x00B5, 0x00B6, 0x00B7,
+			0x017E, 0x00B9, 0x00BA, 0x00BB, 0x0152, 0x0153, 0x0178, 0x00BF,
+			0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+			0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+			0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+			0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+			0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+			0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
+		};
+
+		/** iso-8859-16, bytes 0x80-0xFF. **/
+		const ushort ISO_8859_16_TABLE[128] =
+		{
+			0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+			0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+			0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+			0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+			0x00A0, 0x0104, 0x0105, 0x0141, 0x20AC, 0x201E, 0x0160, 0x00A7,
+			0x0161, 0x00A9, 0x0218, 0x00AB, 0x0179, 0x00AD, 0x017A, 0x017B,
+			0x00B0, 0x00B1, 0x010C, 0x0142, 0x017D, 0x201D, 0x00B6, 0x00B7,
+			0x017E, 0x010D, 0x0219, 0x00BB, 0x0152, 0x0153, 0x0178, 0x017C,
+			0x00C0, 0x00C1, 0x00C2, 0x0102, 0x00C4, 0x0106, 0x00C6, 0x00C7,
+			0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+			0x0110, 0x0143, 0x00D2, 0x00D3, 0x00D4, 0x0150, 0x00D6, 0x015A,
+			0x0170, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x0118, 0x021A, 0x00DF,
+			0x00E0, 0x00E1, 0x00E2, 0x0103, 0x00E4, 0x0107, 0x00E6, 0x00E7,
+			0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+			0x0111, 0x0144, 0x00F2, 0x00F3, 0x00F4, 0x0151, 0x00F6, 0x015B,
+			0x0171, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x0119, 0x021B, 0x00FF
+		};
+		/** Single-byte charset name & table. **/
+		struct Charset
+		{
+
+			/** Lower-case name. **/
+			const char * mName;
+
+			/** Table of bytes 0x80-0xFF. **/
+			const ushort * mTable;
+
+		}; /// Charset
+
+		/** Supported charsets & their aliases. ISO-8859 parts searched by number. **/
+		const Charset CHARSETS[] =
+		{
+			{ "windows-1251", WINDOWS_1251_TABLE },
+			{ "cp1251", WINDOWS_1251_TABLE },
+			{ "koi8-r", KOI8_R_TABLE },
+			{ "koi8r", KOI8_R_TABLE },
+			{ "latin1", ISO_8859_1_TABLE },
+			{ "iso-8859-1", ISO_8859_1_TABLE },
+			{ "iso-8859-2", ISO_8859_2_TABLE },
+			{ "iso-8859-3", ISO_8859_3_TABLE },
+			{ "iso-8859-4", ISO_8859_4_TABLE },
+			{ "iso-8859-5", ISO_8859_5_TABLE },
+			{ "iso-8859-6", ISO_8859_6_TABLE },
+			{ "iso-8859-7", ISO_8859_7_TABLE },
+			{ "iso-8859-8", ISO_8859_8_TABLE },
+			{ "iso-8859-9", ISO_8859_9_TABLE },
+			{ "iso-8859-10", ISO_8859_10_TABLE },
+			{ "iso-8859-11", ISO_8859_11_TABLE },
+			{ "iso-8859-13", ISO_8859_13_TABLE },
+			{ "iso-8859-14", ISO_8859_14_TABLE },
+			{ "iso-8859-15", ISO_8859_15_TABLE },
+			{ "iso-8859-16", ISO_8859_16_TABLE }
+		};
+
+		/**
+		  * Returns 'true' if byte is plain ASCII character.
+		  *
+		  * @param pByte - byte.
+		  * @return - 'true' if copied as is.
+		**/
+		inline bool isPlainAscii( const char pByte ) noexcept
+		{ return( ( static_cast<uchar>( pByte ) >= 0x20u && static_cast<uchar>( pByte ) < 0x80u && pByte != '&' ) || pByte == '\n' || pByte == '\t' ); }
+
+		/**
+		  * Checks that bytes start with prefix.
+		  *
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pPrefix - prefix.
+		  * @param pLength - prefix length.
+		  * @return - 'true' if bytes start with prefix.
+		**/
+		inline bool startsWith( const char *const pFrom, const char *const pTo, const char *const pPrefix, const int pLength ) noexcept
+		{ return( pTo - pFrom >= pLength && std::memcmp( pFrom, pPrefix, static_cast<size_t>( pLength ) ) == 0 ); }
+
+		/**
+		  * Searches bytes sequence (CDATA & comment ends are rare, so plain memchr search).
+		  *
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pSequence - bytes to search.
+		  * @param pLength - sequence length.
+		  * @return - sequence position, or pTo if not found.
+		**/
+		const char * findSequence( const char * pFrom, const char *const pTo, const char *const pSequence, const int pLength ) noexcept
+		{
+
+			// Search first byte, then compare the rest.
+			while( pTo - pFrom >= pLength )
+			{
+
+				// Search first byte.
+				pFrom = static_cast<const char*>( std::memchr( pFrom, pSequence[0], static_cast<size_t>( pTo - pFrom - pLength + 1 ) ) );
+				if ( pFrom == nullptr )
+					break;
+
+				// Compare
+				if ( std::memcmp( pFrom, pSequence, static_cast<size_t>( pLength ) ) == 0 )
+					return( pFrom );
+
+				// Next
+				pFrom++;
+
+			} /// Search first byte, then compare the rest.
+
+			// Return end.
+			return( pTo );
+
+		}
+
+	} // namespace
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Searches table of single-byte charset.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pName - encoding name from Xml-declaration ("windows-1251"), case ignored.
+	  * @param pLength - name length.
+	  * @return - UTF-16 codes of bytes 0x80-0xFF (0 if byte undefined), or null if charset unsupported.
+	  * @throws - no exceptions.
+	**/
+	const ushort * CharsetDecoder::findTable( const char *const pName, const int pLength ) noexcept
+	{
+
+		// Cancel, if name too long.
+		if ( pLength <= 0 || pLength >= MAX_NAME_LENGTH )
+			return( nullptr );
+
+		// Lower-case name. "iso8859-5" & "iso_8859-5" spelled as "iso-8859-5".
+		char name_[MAX_NAME_LENGTH];
+		int length_( 0 );
+		for( int i = 0; i < pLength; i++ )
+		{
+
+			// Lower-case byte.
+			const char byte_( pName[i] >= 'A' && pName[i] <= 'Z' ? static_cast<char>( pName[i] - 'A' + 'a' ) : pName[i] );
+
+			// Add '-' after "iso".
+			if ( length_ == 3 && std::strncmp( name_, "iso", 3 ) == 0 && byte_ != '-' )
+			{
+				name_[length_++] = '-';
+				if ( byte_ == '_' )
+					continue;
+			}
+
+			// Add byte.
+			if ( length_ < MAX_NAME_LENGTH - 1 )
+				name_[length_++] = byte_;
+
+		} /// Lower-case name.
+		name_[length_] = '\0';
+
+		// Search charset.
+		for( const Charset & charset_ : CHARSETS )
+		{
+			if ( std::strcmp( charset_.mName, name_ ) == 0 )
+				return( charset_.mTable );
+		}
+
+		// Unsupported
+		return( nullptr );
+
+	} /// CharsetDecoder::findTable
+
+	/**
+	  * Copies run of plain ASCII bytes (no '&', '\r', control characters) to UTF-16.
+	  *
+	  * (?) Up to 16 characters written after run end, so output must have room
+	  * for (pTo - pFrom) characters.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pFrom - first byte.
+	  * @param pTo - end of bytes.
+	  * @param pOut - characters output.
+	  * @return - number of bytes (characters) copied.
+	  * @throws - no exceptions.
+	**/
+	int CharsetDecoder::widenAscii( const char *const pFrom, const char *const pTo, QChar *const pOut ) noexcept
+	{
+
+		// Position
+		const char * pos_( pFrom );
+
+		// Output, QChar is stored as UTF-16 code.
+		ushort *const out_( reinterpret_cast<ushort*>( pOut ) );
+
+#if defined( QRSS_READER_CHARSET_DECODER_SSE2 )
+		// Constants
+		const __m128i zero_( _mm_setzero_si128( ) );
+		const __m128i space_( _mm_set1_epi8( 0x20 ) );
+		const __m128i lineFeed_( _mm_set1_epi8( '\n' ) );
+		const __m128i tab_( _mm_set1_epi8( '\t' ) );
+		const __m128i ampersand_( _mm_set1_epi8( '&' ) );
+
+		// 16 bytes per step.
+		while( pTo - pos_ >= 16 )
+		{
+
+			// Load bytes.
+			const __m128i bytes_( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pos_ ) ) );
+
+			// Signed compare: control characters & non-ASCII (high bit) bytes are less than space.
+			const __m128i allowed_( _mm_or_si128( _mm_cmpeq_epi8( bytes_, lineFeed_ ), _mm_cmpeq_epi8( bytes_, tab_ ) ) );
+			const __m128i special_( _mm_or_si128( _mm_andnot_si128( allowed_, _mm_cmplt_epi8( bytes_, space_ ) ), _mm_cmpeq_epi8( bytes_, ampersand_ ) ) );
+			const unsigned int mask_( static_cast<unsigned int>( _mm_movemask_epi8( special_ ) ) );
+
+			// Widen 16 bytes to 16 characters.
+			ushort *const chars_( out_ + ( pos_ - pFrom ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i*>( chars_ ), _mm_unpacklo_epi8( bytes_, zero_ ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i*>( chars_ + 8 ), _mm_unpackhi_epi8( bytes_, zero_ ) );
+
+			// Run ends in this block.
+			if ( mask_ != 0 )
+			{
+#if defined( _MSC_VER )
+				unsigned long index_( 0 );
+				_BitScanForward( &index_, mask_ );
+#else // !MSVC
+				const int index_( __builtin_ctz( mask_ ) );
+#endif // MSVC
+				return( static_cast<int>( pos_ - pFrom ) + static_cast<int>( index_ ) );
+			}
+
+			// Next
+			pos_ += 16;
+
+		} /// 16 bytes per step.
+#endif // SSE2
+
+		// Tail
+		while( pos_ < pTo && isPlainAscii( *pos_ ) )
+		{
+			out_[pos_ - pFrom] = static_cast<ushort>( static_cast<uchar>( *pos_ ) );
+			pos_++;
+		}
+
+		// Return number of copied bytes.
+		return( static_cast<int>( pos_ - pFrom ) );
+
+	} /// CharsetDecoder::widenAscii
+
+	/**
+	  * Decodes entity (&amp;, &#160;, &#xA0;).
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pFrom - '&' position, moved after ';'.
+	  * @param pTo - end of bytes.
+	  * @param pOut - characters output, 2 characters at most.
+	  * @return - number of characters, or 0 if entity unknown or invalid.
+	  * @throws - no exceptions.
+	**/
+	int CharsetDecoder::decodeEntity( const char *& pFrom, const char *const pTo, QChar *const pOut ) noexcept
+	{
+
+		// Name start.
+		const char *const name_( pFrom + 1 );
+
+		// Search ';', entities are short.
+		const char * end_( name_ );
+		while( end_ < pTo && end_ - name_ < 10 && *end_ != ';' )
+			end_++;
+
+		// Cancel, if not terminated.
+		if ( end_ >= pTo || *end_ != ';' )
+			return( 0 );
+
+		// Name Length.
+		const int length_( static_cast<int>( end_ - name_ ) );
+
+		// Character code.
+		uint code_( 0 );
+
+		// Character reference.
+		if ( length_ > 1 && name_[0] == '#' )
+		{
+
+			// Hexadecimal
+			const bool hex_( name_[1] == 'x' );
+
+			// Read digits.
+			for( const char * digit_ = name_ + ( hex_ ? 2 : 1 ); digit_ < end_; digit_++ )
+			{
+
+				// Digit value.
+				uint value_( 0 );
+				if ( *digit_ >= '0' && *digit_ <= '9' )
+					value_ = static_cast<uint>( *digit_ - '0' );
+				else if ( hex_ && *digit_ >= 'a' && *digit_ <= 'f' )
+					value_ = static_cast<uint>( *digit_ - 'a' + 10 );
+				else if ( hex_ && *digit_ >= 'A' && *digit_ <= 'F' )
+					value_ = static_cast<uint>( *digit_ - 'A' + 10 );
+				else
+					return( 0 );
+
+				// Add digit.
+				code_ = code_ * ( hex_ ? 16u : 10u ) + value_;
+
+			} /// Read digits.
+
+			// Cancel, if no digits or not a character.
+			if ( end_ - name_ <= ( hex_ ? 2 : 1 ) || code_ == 0 || code_ > 0x10FFFFu || ( code_ >= 0xD800u && code_ <= 0xDFFFu ) )
+				return( 0 );
+
+		} /// Character reference.
+		else if ( length_ == 2 && name_[0] == 'l' && name_[1] == 't' )
+			code_ = '<';
+		else if ( length_ == 2 && name_[0] == 'g' && name_[1] == 't' )
+			code_ = '>';
+		else if ( length_ == 3 && std::memcmp( name_, "amp", 3 ) == 0 )
+			code_ = '&';
+		else if ( length_ == 4 && std::memcmp( name_, "quot", 4 ) == 0 )
+			code_ = '"';
+		else if ( length_ == 4 && std::memcmp( name_, "apos", 4 ) == 0 )
+			code_ = '\'';
+		else
+			return( 0 ); // Declared in DTD, unsupported.
+
+		// Move after ';'.
+		pFrom = end_ + 1;
+
+		// Surrogate pair.
+		if ( QChar::requiresSurrogates( code_ ) )
+		{
+			pOut[0] = QChar( QChar::highSurrogate( code_ ) );
+			pOut[1] = QChar( QChar::lowSurrogate( code_ ) );
+			return( 2 );
+		}
+
+		// Return one character.
+		pOut[0] = QChar( static_cast<ushort>( code_ ) );
+		return( 1 );
+
+	} /// CharsetDecoder::decodeEntity
+
+	/**
+	  * Decodes UTF-8 (or single-byte charset) bytes to characters.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pFrom - first byte.
+	  * @param pTo - end of bytes.
+	  * @param pEntities - 'true' to replace entities (&amp;, &#160;).
+	  * @param pCharset - table of single-byte charset, null for UTF-8.
+	  * @param pOut - characters output, room for (pTo - pFrom) characters.
+	  * @return - number of characters, or -1 if bytes invalid.
+	  * @throws - no exceptions.
+	**/
+	int CharsetDecoder::decode( const char * pFrom, const char *const pTo, const bool pEntities, const ushort *const pCharset, QChar *const pOut ) noexcept
+	{
+
+		// Output
+		QChar *const out_( pOut );
+		int length_( 0 );
+
+		// Decode bytes.
+		while( pFrom < pTo )
+		{
+
+			// Byte
+			const uchar byte_( static_cast<uchar>( *pFrom ) );
+
+			// ASCII
+			if ( byte_ < 0x80 )
+			{
+
+				// Run of plain characters, 16 bytes per step.
+				const int run_( widenAscii( pFrom, pTo, out_ + length_ ) );
+				if ( run_ > 0 )
+				{
+					pFrom += run_;
+					length_ += run_;
+					continue;
+				}
+
+				// Entity
+				if ( byte_ == '&' && pEntities )
+				{
+
+					// Decode Entity.
+					const int entityLength_( decodeEntity( pFrom, pTo, out_ + length_ ) );
+					if ( entityLength_ == 0 )
+						return( -1 );
+
+					// Next
+					length_ += entityLength_;
+					continue;
+
+				} /// Entity
+
+				// Line-break (\r\n, \r) normalized to \n, as Xml requires.
+				if ( byte_ == '\r' )
+				{
+					out_[length_++] = QChar( '\n' );
+					pFrom++;
+					if ( pFrom < pTo && *pFrom == '\n' )
+						pFrom++;
+					continue;
+				}
+
+				// Control characters are not allowed.
+				if ( byte_ < 0x20 && byte_ != '\n' && byte_ != '\t' )
+					return( -1 );
+
+				// Character
+				out_[length_++] = QChar( byte_ );
+				pFrom++;
+				continue;
+
+			} /// ASCII
+
+			// Single-byte charset.
+			if ( pCharset != nullptr )
+			{
+
+				// Character, 0 if byte undefined.
+				const ushort code_( pCharset[byte_ - 0x80] );
+				if ( code_ == 0 )
+					return( -1 );
+
+				// Next
+				out_[length_++] = QChar( code_ );
+				pFrom++;
+				continue;
+
+			} /// Single-byte charset.
+
+			// Sequence length & first bits.
+			int sequence_( 0 );
+			uint code_( 0 );
+			uint minCode_( 0 );
+			if ( ( byte_ & 0xE0 ) == 0xC0 )
+			{
+				sequence_ = 2;
+				code_ = byte_ & 0x1Fu;
+				minCode_ = 0x80u;
+			}
+			else if ( ( byte_ & 0xF0 ) == 0xE0 )
+			{
+				sequence_ = 3;
+				code_ = byte_ & 0x0Fu;
+				minCode_ = 0x800u;
+			}
+			else if ( ( byte_ & 0xF8 ) == 0xF0 )
+			{
+				sequence_ = 4;
+				code_ = byte_ & 0x07u;
+				minCode_ = 0x10000u;
+			}
+			else
+				return( -1 );
+
+			// Cancel, if truncated.
+			if ( pTo - pFrom < sequence_ )
+				return( -1 );
+
+			// Continuation bytes.
+			for( int i = 1; i < sequence_; i++ )
+			{
+
+				// Continuation byte.
+				const uchar next_( static_cast<uchar>( pFrom[i] ) );
+				if ( ( next_ & 0xC0 ) != 0x80 )
+					return( -1 );
+
+				// Add bits.
+				code_ = ( code_ << 6 ) | ( next_ & 0x3Fu );
+
+			} /// Continuation bytes.
+
+			// Reject overlong sequences, surrogates & out of range.
+			if ( code_ < minCode_ || code_ > 0x10FFFFu || ( code_ >= 0xD800u && code_ <= 0xDFFFu ) )
+				return( -1 );
+
+			// Characters
+			if ( QChar::requiresSurrogates( code_ ) )
+			{
+				out_[length_++] = QChar( QChar::highSurrogate( code_ ) );
+				out_[length_++] = QChar( QChar::lowSurrogate( code_ ) );
+			}
+			else
+				out_[length_++] = QChar( static_cast<ushort>( code_ ) );
+
+			// Next
+			pFrom += sequence_;
+
+		} /// Decode bytes.
+
+		// Return number of characters.
+		return( length_ );
+
+	} /// CharsetDecoder::decode
+
+	/**
+	  * Decodes raw Element content: Text (entities replaced) & CDATA sections, comments skipped.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pFrom - first byte.
+	  * @param pTo - end of bytes.
+	  * @param pCharset - table of single-byte charset, null for UTF-8.
+	  * @param pOut - characters output, room for (pTo - pFrom) characters.
+	  * @return - number of characters, or -1 if bytes invalid or contain other markup.
+	  * @throws - no exceptions.
+	**/
+	int CharsetDecoder::decodeContent( const char * pFrom, const char *const pTo, const ushort *const pCharset, QChar *const pOut ) noexcept
+	{
+
+		// Number of characters.
+		int length_( 0 );
+
+		// Decode Text & CDATA sections.
+		while( pFrom < pTo )
+		{
+
+			// Next markup.
+			const char * markup_( static_cast<const char*>( std::memchr( pFrom, '<', static_cast<size_t>( pTo - pFrom ) ) ) );
+			if ( markup_ == nullptr )
+				markup_ = pTo;
+
+			// Text, entities replaced.
+			if ( markup_ > pFrom )
+			{
+				const int textLength_( decode( pFrom, markup_, true, pCharset, pOut + length_ ) );
+				if ( textLength_ < 0 )
+					return( -1 );
+				length_ += textLength_;
+			}
+
+			// Content end.
+			if ( markup_ == pTo )
+				break;
+
+			// CDATA, no entities.
+			if ( startsWith( markup_, pTo, "<![CDATA[", 9 ) )
+			{
+
+				// CDATA bytes.
+				const char *const from_( markup_ + 9 );
+				const char *const to_( findSequence( from_, pTo, "]]>", 3 ) );
+				if ( to_ == pTo )
+					return( -1 );
+
+				// Decode
+				const int cdataLength_( decode( from_, to_, false, pCharset, pOut + length_ ) );
+				if ( cdataLength_ < 0 )
+					return( -1 );
+				length_ += cdataLength_;
+
+				// Move after CDATA.
+				pFrom = to_ + 3;
+				continue;
+
+			} /// CDATA, no entities.
+
+			// Comment, skipped.
+			if ( startsWith( markup_, pTo, "<!--", 4 ) )
+			{
+
+				// Comment end.
+				const char *const to_( findSequence( markup_ + 4, pTo, "-->", 3 ) );
+				if ( to_ == pTo )
+					return( -1 );
+
+				// Move after comment.
+				pFrom = to_ + 3;
+				continue;
+
+			} /// Comment, skipped.
+
+			// Other markup is not Text.
+			return( -1 );
+
+		} /// Decode Text & CDATA sections.
+
+		// Return number of characters.
+		return( length_ );
+
+	} /// CharsetDecoder::decodeContent
+
+	// -----------------------------------------------------------
+
+} // rss
+
+// -----------------------------------------------------------
@@ -0,0 +1,171 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_CHARSET_DECODER_HPP
+#define QRSS_READER_CHARSET_DECODER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QChar
+#ifndef QCHAR_H
+#include <qchar.h>
+#endif // !QCHAR_H
+
+// ===========================================================
+// rss::CharsetDecoder
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * CharsetDecoder - decoding helpers for rss::FastRSSScanner.
+	  *
+	  * @brief
+	  * Plain ASCII runs (most of RSS markup & Text) widened to UTF-16
+	  * with SSE2, 16 bytes per step. Single-byte charsets (windows-1251, KOI8-R,
+	  * ISO-8859-*) decoded with 128-entry tables, Text-node by Text-node,
+	  * so document is never converted whole.
+	  * Raw Element content (Text & CDATA), kept by rss::Text, decoded on first use.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	class CharsetDecoder final
+	{
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// DELETED CONSTRUCTORS & OPERATORS
+		// ===========================================================
+
+		/** @deleted CharsetDecoder default constructor. **/
+		CharsetDecoder( ) noexcept = delete;
+
+		/** @deleted CharsetDecoder const copy constructor. **/
+		CharsetDecoder( const CharsetDecoder & ) noexcept = delete;
+
+		/** @deleted CharsetDecoder copy-assignment operator. **/
+		CharsetDecoder & operator=( const CharsetDecoder & ) noexcept = delete;
+
+		/** @deleted CharsetDecoder move constructor. **/
+		CharsetDecoder( CharsetDecoder && ) noexcept = delete;
+
+		/** @deleted CharsetDecoder move assignment operator. **/
+		CharsetDecoder & operator=( CharsetDecoder && ) noexcept = delete;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Searches table of single-byte charset.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pName - encoding name from Xml-declaration ("windows-1251"), case ignored.
+		  * @param pLength - name length.
+		  * @return - UTF-16 codes of bytes 0x80-0xFF (0 if byte undefined), or null if charset unsupported.
+		  * @throws - no exceptions.
+		**/
+		static const ushort * findTable( const char *const pName, const int pLength ) noexcept;
+
+		/**
+		  * Copies run of plain ASCII bytes (no '&', '\r', control characters) to UTF-16.
+		  *
+		  * (?) Up to 16 characters written after run end, so output must have room
+		  * for (pTo - pFrom) characters.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pOut - characters output.
+		  * @return - number of bytes (characters) copied.
+		  * @throws - no exceptions.
+		**/
+		static int widenAscii( const char *const pFrom, const char *const pTo, QChar *const pOut ) noexcept;
+
+		/**
+		  * Decodes entity (&amp;, &#160;, &#xA0;).
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pFrom - '&' position, moved after ';'.
+		  * @param pTo - end of bytes.
+		  * @param pOut - characters output, 2 characters at most.
+		  * @return - number of characters, or 0 if entity unknown or invalid.
+		  * @throws - no exceptions.
+		**/
+		static int decodeEntity( const char *& pFrom, const char *const pTo, QChar *const pOut ) noexcept;
+
+		/**
+		  * Decodes UTF-8 (or single-byte charset) bytes to characters.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pEntities - 'true' to replace entities (&amp;, &#160;).
+		  * @param pCharset - table of single-byte charset, null for UTF-8.
+		  * @param pOut - characters output, room for (pTo - pFrom) characters.
+		  * @return - number of characters, or -1 if bytes invalid.
+		  * @throws - no exceptions.
+		**/
+		static int decode( const char * pFrom, const char *const pTo, const bool pEntities, const ushort *const pCharset, QChar *const pOut ) noexcept;
+
+		/**
+		  * Decodes raw Element content: Text (entities replaced) & CDATA sections, comments skipped.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pCharset - table of single-byte charset, null for UTF-8.
+		  * @param pOut - characters output, room for (pTo - pFrom) characters.
+		  * @return - number of characters, or -1 if bytes invalid or contain other markup.
+		  * @throws - no exceptions.
+		**/
+		static int decodeContent( const char * pFrom, const char *const pTo, const ushort *const pCharset, QChar *const pOut ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // rss::CharsetDecoder
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_CHARSET_DECODER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_CHARSET_DECODER_HPP
@@ -0,0 +1,307 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef QRSS_READER_ELEMENT_ARENA_HPP
+#include "ElementArena.hpp"
+#endif // !QRSS_READER_ELEMENT_ARENA_HPP
+
+// Include C++ new (operator new, std::bad_alloc).
+#include <new>
+
+// ===========================================================
+// rss::ElementArena
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// CONSTANTS
+	// ===========================================================
+
+	constexpr size_t ElementArena::BLOCK_SIZE;
+	constexpr size_t ElementArena::HEADER_SIZE;
+	constexpr quintptr ElementArena::HEAP_TAG;
+	constexpr quintptr ElementArena::ARENA_TAG;
+
+	// Header must fit allocation tag.
+	static_assert( sizeof( quintptr ) <= alignof( std::max_align_t ), "ElementArena::HEADER_SIZE - header can't store tag !" );
+
+	// ===========================================================
+	// FIELDS
+	// ===========================================================
+
+	/** Arena bound to thread. **/
+	thread_local ElementArena * ElementArena::mCurrent( nullptr );
+
+	/** Number of blocks allocated by thread. **/
+	thread_local qint64 ElementArena::mBlocksAllocated( 0 );
+
+	/** Number of block bytes allocated by thread. **/
+	thread_local qint64 ElementArena::mBytesReserved( 0 );
+
+	/** Number of block bytes used by thread. **/
+	thread_local qint64 ElementArena::mBytesUsed( 0 );
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	  * ElementArena constructor. Blocks allocated on first use.
+	  *
+	  * @throws - no exceptions.
+	**/
+	ElementArena::ElementArena( ) noexcept
+		: mBlocks( ),
+		  mPos( nullptr ),
+		  mEnd( nullptr )
+	{ }
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	  * ElementArena destructor. Frees all blocks,
+	  * Elements must be already destructed.
+	  *
+	  * @throws - no exceptions.
+	**/
+	ElementArena::~ElementArena( ) noexcept
+	{
+
+		// Unbind, if Arena still bound to this thread.
+		if ( mCurrent == this )
+			mCurrent = nullptr;
+
+		// Free blocks.
+		for( char * block_ : mBlocks )
+			::operator delete( block_ );
+
+	}
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Allocates bytes from Arena blocks.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pSize - number of bytes, including header.
+	  * @return - memory.
+	  * @throws - std::bad_alloc, if block can't be allocated.
+	**/
+	void * ElementArena::bump( const size_t pSize )
+	{
+
+		// Keep alignment of next allocation.
+		const size_t size_( ( pSize + HEADER_SIZE - 1 ) & ~( HEADER_SIZE - 1 ) );
+		mBytesUsed += static_cast<qint64>( size_ );
+
+		// Large allocation, own block. Current block kept.
+		if ( size_ > BLOCK_SIZE / 4 )
+		{
+			char *const block_( static_cast<char*>( ::operator new( size_ ) ) );
+			mBlocks.push_back( block_ );
+			mBlocksAllocated++;
+			mBytesReserved += static_cast<qint64>( size_ );
+			return( block_ );
+		}
+
+		// New block, rest of current block not used.
+		if ( static_cast<size_t>( mEnd - mPos ) < size_ )
+		{
+			mPos = static_cast<char*>( ::operator new( BLOCK_SIZE ) );
+			mEnd = mPos + BLOCK_SIZE;
+			mBlocks.push_back( mPos );
+			mBlocksAllocated++;
+			mBytesReserved += static_cast<qint64>( BLOCK_SIZE );
+		}
+
+		// Bump
+		void *const result_( mPos );
+		mPos += size_;
+
+		// Return memory.
+		return( result_ );
+
+	} /// ElementArena::bump
+
+	/**
+	  * Allocates Element memory, from Arena bound to calling thread, or heap.
+	  *
+	  * @threadsafe - thread-safe, bound Arena used only by calling thread.
+	  * @param pSize - Element size.
+	  * @return - memory.
+	  * @throws - std::bad_alloc.
+	**/
+	void * ElementArena::allocate( const size_t pSize )
+	{
+
+		// Arena, or heap memory with header.
+		char *const memory_( static_cast<char*>( mCurrent != nullptr ? mCurrent->bump( HEADER_SIZE + pSize ) : ::operator new( HEADER_SIZE + pSize ) ) );
+
+		// Write header.
+		*reinterpret_cast<quintptr*>( memory_ ) = mCurrent != nullptr ? ARENA_TAG : HEAP_TAG;
+
+		// Return memory after header.
+		return( memory_ + HEADER_SIZE );
+
+	} /// ElementArena::allocate
+
+	/**
+	  * Releases Element memory. Heap memory freed, Arena memory kept until Arena destructed.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pMemory - memory, returned by #allocate, or null.
+	  * @throws - no exceptions.
+	**/
+	void ElementArena::release( void *const pMemory ) noexcept
+	{
+
+		// Cancel, if null.
+		if ( pMemory == nullptr )
+			return;
+
+		// Header
+		char *const memory_( static_cast<char*>( pMemory ) - HEADER_SIZE );
+		const quintptr tag_( *reinterpret_cast<const quintptr*>( memory_ ) );
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Check header.
+		Q_ASSERT( tag_ == HEAP_TAG || tag_ == ARENA_TAG );
+#endif // DEBUG
+
+		// Free heap memory.
+		if ( tag_ == HEAP_TAG )
+			::operator delete( memory_ );
+
+	} /// ElementArena::release
+
+	/**
+	  * Binds Arena to calling thread.
+	  *
+	  * @threadsafe - thread-safe, binding is per-thread.
+	  * @param pArena - Arena, or null to allocate Elements on heap.
+	  * @return - previously bound Arena, or null.
+	  * @throws - no exceptions.
+	**/
+	ElementArena * ElementArena::bind( ElementArena *const pArena ) noexcept
+	{
+
+		// Previous Arena.
+		ElementArena *const result_( mCurrent );
+
+		// Bind
+		mCurrent = pArena;
+
+		// Return previous Arena.
+		return( result_ );
+
+	} /// ElementArena::bind
+
+	/**
+	  * Returns 'true' if Arena bound to calling thread.
+	  *
+	  * @threadsafe - thread-safe, binding is per-thread.
+	  * @throws - no exceptions.
+	**/
+	bool ElementArena::isBound( ) noexcept
+	{ return( mCurrent != nullptr ); }
+
+	/**
+	  * Returns 'true' if memory allocated on heap, not in Arena.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pMemory - memory, returned by #allocate.
+	  * @throws - no exceptions.
+	**/
+	bool ElementArena::isHeap( const void *const pMemory ) noexcept
+	{ return( *reinterpret_cast<const quintptr*>( static_cast<const char*>( pMemory ) - HEADER_SIZE ) == HEAP_TAG ); }
+
+	/**
+	  * Moves blocks of other Arena to this Arena.
+	  * Used, when Elements of merged Channel moved.
+	  *
+	  * @threadsafe - not thread-safe, both Arenas must not allocate.
+	  * @param pOther - Arena to take blocks from, empty after call.
+	  * @throws - no exceptions.
+	**/
+	void ElementArena::adopt( ElementArena & pOther ) noexcept
+	{
+
+		// Cancel, if same Arena, or nothing to take.
+		if ( &pOther == this || pOther.mBlocks.isEmpty( ) )
+			return;
+
+		// Take blocks, current block of this Arena kept.
+		mBlocks += pOther.mBlocks;
+
+		// Reset other Arena.
+		pOther.mBlocks.clear( );
+		pOther.mPos = nullptr;
+		pOther.mEnd = nullptr;
+
+	} /// ElementArena::adopt
+
+	/**
+	  * Returns number of blocks allocated by calling thread.
+	  * Used to count parsing allocations.
+	  *
+	  * @threadsafe - thread-safe, counter is per-thread.
+	  * @throws - no exceptions.
+	**/
+	qint64 ElementArena::countBlocks( ) noexcept
+	{ return( mBlocksAllocated ); }
+
+	/**
+	  * Returns number of block bytes allocated by calling thread.
+	  *
+	  * @threadsafe - thread-safe, counter is per-thread.
+	  * @throws - no exceptions.
+	**/
+	qint64 ElementArena::countReservedBytes( ) noexcept
+	{ return( mBytesReserved ); }
+
+	/**
+	  * Returns number of block bytes used by Elements, allocated by calling thread.
+	  *
+	  * @threadsafe - thread-safe, counter is per-thread.
+	  * @throws - no exceptions.
+	**/
+	qint64 ElementArena::countUsedBytes( ) noexcept
+	{ return( mBytesUsed ); }
+
+	// -----------------------------------------------------------
+
+} // rss
+
+// -----------------------------------------------------------
@@ -0,0 +1,272 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_ELEMENT_ARENA_HPP
+#define QRSS_READER_ELEMENT_ARENA_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include qglobal (qint64)
+#ifndef QGLOBAL_H
+#include <qglobal.h>
+#endif // !QGLOBAL_H
+
+// Include QVector
+#ifndef QVECTOR_H
+#include <qvector.h>
+#endif // !QVECTOR_H
+
+// Include C++ size_t.
+#include <cstddef>
+
+// ===========================================================
+// rss::ElementArena
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * ElementArena - monotonic (bump-pointer) memory of Channel Elements & Items.
+	  *
+	  * @brief
+	  * Each Channel owns Arena. While RSS-file parsed, Handler binds Channel Arena
+	  * to parsing thread (#bind), so Elements (Items, Texts, Links, Dates, etc)
+	  * created by Element::operator new are bump-allocated from BLOCK_SIZE blocks.
+	  * Deleting Element only calls destructor, memory freed with whole Arena (Channel).
+	  * Merged Channel passes it's blocks to destination Channel (#adopt).
+	  * Without bound Arena, Element allocated on heap, as before.
+	  * Every allocation has small header, so delete knows where Element lives.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	class ElementArena final
+	{
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Size of Arena block. **/
+		static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+		/** Size of allocation header, keeps Element alignment. **/
+		static constexpr size_t HEADER_SIZE = alignof( std::max_align_t );
+
+		/** Header value of heap allocation. **/
+		static constexpr quintptr HEAP_TAG = 0x48454150u;
+
+		/** Header value of Arena allocation. **/
+		static constexpr quintptr ARENA_TAG = 0x4152454Eu;
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Blocks, owned by Arena. **/
+		QVector<char*> mBlocks;
+
+		/** Free bytes of current block. **/
+		char * mPos;
+
+		/** End of current block. **/
+		char * mEnd;
+
+		/** Arena bound to thread, null if Elements allocated on heap. **/
+		static thread_local ElementArena * mCurrent;
+
+		/** Number of blocks allocated by thread. **/
+		static thread_local qint64 mBlocksAllocated;
+
+		/** Number of block bytes allocated by thread. **/
+		static thread_local qint64 mBytesReserved;
+
+		/** Number of block bytes used by thread. **/
+		static thread_local qint64 mBytesUsed;
+
+		// ===========================================================
+		// DELETED CONSTRUCTORS & OPERATORS
+		// ===========================================================
+
+		/** @deleted ElementArena const copy constructor. **/
+		ElementArena( const ElementArena & ) noexcept = delete;
+
+		/** @deleted ElementArena copy-assignment operator. **/
+		ElementArena & operator=( const ElementArena & ) noexcept = delete;
+
+		/** @deleted ElementArena move constructor. **/
+		ElementArena( ElementArena && ) noexcept = delete;
+
+		/** @deleted ElementArena move assignment operator. **/
+		ElementArena & operator=( ElementArena && ) noexcept = delete;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Allocates bytes from Arena blocks.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pSize - number of bytes, including header.
+		  * @return - memory.
+		  * @throws - std::bad_alloc, if block can't be allocated.
+		**/
+		void * bump( const size_t pSize );
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		  * ElementArena constructor. Blocks allocated on first use.
+		  *
+		  * @throws - no exceptions.
+		**/
+		explicit ElementArena( ) noexcept;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		  * ElementArena destructor. Frees all blocks,
+		  * Elements must be already destructed.
+		  *
+		  * @throws - no exceptions.
+		**/
+		~ElementArena( ) noexcept;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Allocates Element memory, from Arena bound to calling thread, or heap.
+		  *
+		  * @threadsafe - thread-safe, bound Arena used only by calling thread.
+		  * @param pSize - Element size.
+		  * @return - memory.
+		  * @throws - std::bad_alloc.
+		**/
+		static void * allocate( const size_t pSize );
+
+		/**
+		  * Releases Element memory. Heap memory freed, Arena memory kept until Arena destructed.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pMemory - memory, returned by #allocate, or null.
+		  * @throws - no exceptions.
+		**/
+		static void release( void *const pMemory ) noexcept;
+
+		/**
+		  * Binds Arena to calling thread.
+		  *
+		  * @threadsafe - thread-safe, binding is per-thread.
+		  * @param pArena - Arena, or null to allocate Elements on heap.
+		  * @return - previously bound Arena, or null.
+		  * @throws - no exceptions.
+		**/
+		static ElementArena * bind( ElementArena *const pArena ) noexcept;
+
+		/**
+		  * Returns 'true' if Arena bound to calling thread.
+		  *
+		  * @threadsafe - thread-safe, binding is per-thread.
+		  * @throws - no exceptions.
+		**/
+		static bool isBound( ) noexcept;
+
+		/**
+		  * Returns 'true' if memory allocated on heap, not in Arena.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pMemory - memory, returned by #allocate.
+		  * @throws - no exceptions.
+		**/
+		static bool isHeap( const void *const pMemory ) noexcept;
+
+		/**
+		  * Moves blocks of other Arena to this Arena.
+		  * Used, when Elements of merged Channel moved.
+		  *
+		  * @threadsafe - not thread-safe, both Arenas must not allocate.
+		  * @param pOther - Arena to take blocks from, empty after call.
+		  * @throws - no exceptions.
+		**/
+		void adopt( ElementArena & pOther ) noexcept;
+
+		/**
+		  * Returns number of blocks allocated by calling thread.
+		  * Used to count parsing allocations.
+		  *
+		  * @threadsafe - thread-safe, counter is per-thread.
+		  * @throws - no exceptions.
+		**/
+		static qint64 countBlocks( ) noexcept;
+
+		/**
+		  * Returns number of block bytes allocated by calling thread.
+		  *
+		  * @threadsafe - thread-safe, counter is per-thread.
+		  * @throws - no exceptions.
+		**/
+		static qint64 countReservedBytes( ) noexcept;
+
+		/**
+		  * Returns number of block bytes used by Elements, allocated by calling thread.
+		  *
+		  * @threadsafe - thread-safe, counter is per-thread.
+		  * @throws - no exceptions.
+		**/
+		static qint64 countUsedBytes( ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // rss::ElementArena
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_ELEMENT_ARENA_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_ELEMENT_ARENA_HPP
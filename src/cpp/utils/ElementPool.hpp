@@ -0,0 +1,445 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_ELEMENT_POOL_HPP
+#define QRSS_READER_ELEMENT_POOL_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include rss::ElementArena
+#ifndef QRSS_READER_ELEMENT_ARENA_HPP
+#include "ElementArena.hpp"
+#endif // !QRSS_READER_ELEMENT_ARENA_HPP
+
+// Include rss::PoolStats
+#ifndef QRSS_READER_POOL_STATS_HPP
+#include "PoolStats.hpp"
+#endif // !QRSS_READER_POOL_STATS_HPP
+
+// Include QMutex
+#ifndef QMUTEX_H
+#include <qmutex.h>
+#endif // !QMUTEX_H
+
+// Include QAtomicInteger
+#ifndef QATOMIC_H
+#include <qatomic.h>
+#endif // !QATOMIC_H
+
+// Include C++ size_t.
+#include <cstddef>
+
+// ===========================================================
+// rss::ElementPool
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * ElementPool - free-list of memory for Elements of one type (Text, Link, Date).
+	  *
+	  * @brief
+	  * Used by operator new & delete of frequent Elements, allocated on heap:
+	  * Elements of lazy-loaded Items, and Elements of re-read (updated) RSS-files,
+	  * created & rejected (duplicates) on each update.
+	  * While Channel Arena bound (first read), Arena used, pool not touched.
+	  * Released memory kept by calling thread cache (no locks), cache overflow
+	  * moved to shared list under mutex, so memory released by GUI-thread
+	  * reused by parsing threads. Shared list is limited, extra memory freed.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	template <typename T>
+	class ElementPool final
+	{
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Max number of free Elements, kept by thread cache. **/
+		static constexpr int CACHE_CAPACITY = 256;
+
+		/** Max number of free Elements, kept by shared list. **/
+		static constexpr int GLOBAL_CAPACITY = 16384;
+
+		/** Number of free Elements, moved between thread cache & shared list at once. **/
+		static constexpr int REFILL_COUNT = 64;
+
+		// ===========================================================
+		// Node
+		// ===========================================================
+
+		/** Free memory, stores pointer to next free memory. **/
+		struct Node
+		{
+
+			/** Next free memory, or null. **/
+			Node * mNext;
+
+		}; // Node
+
+		// ===========================================================
+		// Cache
+		// ===========================================================
+
+		/** Free memory of thread. **/
+		struct Cache
+		{
+
+			/** First free memory, or null. **/
+			Node * mHead;
+
+			/** Number of free memory. **/
+			int mCount;
+
+			/**
+			  * Cache constructor.
+			  *
+			  * @throws - no exceptions.
+			**/
+			Cache( ) noexcept
+				: mHead( nullptr ),
+				  mCount( 0 )
+			{
+			}
+
+			/**
+			  * Cache destructor. Moves free memory to shared list, when thread ends.
+			  *
+			  * @throws - no exceptions.
+			**/
+			~Cache( ) noexcept
+			{ ElementPool<T>::flush( *this, mCount ); }
+
+		}; // Cache
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Free memory of calling thread. **/
+		static thread_local Cache mCache;
+
+		/** Shared list mutex. **/
+		static QMutex mMutex;
+
+		/** Shared list, first free memory. **/
+		static Node * mGlobalHead;
+
+		/** Shared list, number of free memory. **/
+		static int mGlobalCount;
+
+		/** Number of allocations, served by pool. **/
+		static QAtomicInteger<qint64> mHits;
+
+		/** Number of allocations, served by heap. **/
+		static QAtomicInteger<qint64> mMisses;
+
+		/** Number of pooled Elements alive. **/
+		static QAtomicInteger<qint64> mLive;
+
+		/** Max number of pooled Elements alive at once. **/
+		static QAtomicInteger<qint64> mHighWater;
+
+		// ===========================================================
+		// DELETED CONSTRUCTORS & OPERATORS
+		// ===========================================================
+
+		/** @deleted ElementPool default constructor. **/
+		ElementPool( ) noexcept = delete;
+
+		/** @deleted ElementPool const copy constructor. **/
+		ElementPool( const ElementPool & ) noexcept = delete;
+
+		/** @deleted ElementPool copy-assignment operator. **/
+		ElementPool & operator=( const ElementPool & ) noexcept = delete;
+
+		/** @deleted ElementPool move constructor. **/
+		ElementPool( ElementPool && ) noexcept = delete;
+
+		/** @deleted ElementPool move assignment operator. **/
+		ElementPool & operator=( ElementPool && ) noexcept = delete;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Moves free memory from shared list to thread cache.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pCache - thread cache.
+		  * @throws - no exceptions.
+		**/
+		static void refill( Cache & pCache ) noexcept
+		{
+
+			// Lock
+			QMutexLocker lock_( &mMutex );
+
+			// Move up to REFILL_COUNT
+			for ( int i = 0; i < REFILL_COUNT && mGlobalHead != nullptr; i++ )
+			{
+				Node *const node_( mGlobalHead );
+				mGlobalHead = node_->mNext;
+				mGlobalCount--;
+
+				node_->mNext = pCache.mHead;
+				pCache.mHead = node_;
+				pCache.mCount++;
+			}
+
+		} /// refill
+
+		/**
+		  * Moves free memory from thread cache to shared list.
+		  * Memory, exceeding GLOBAL_CAPACITY, freed.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @param pCache - thread cache.
+		  * @param pCount - number of free memory to move.
+		  * @throws - no exceptions.
+		**/
+		static void flush( Cache & pCache, int pCount ) noexcept
+		{
+
+			// Lock
+			QMutexLocker lock_( &mMutex );
+
+			// Move
+			while( pCount > 0 && pCache.mHead != nullptr )
+			{
+				Node *const node_( pCache.mHead );
+				pCache.mHead = node_->mNext;
+				pCache.mCount--;
+				pCount--;
+
+				// Free, if shared list is full.
+				if ( mGlobalCount >= GLOBAL_CAPACITY )
+				{
+					ElementArena::release( node_ );
+					continue;
+				}
+
+				node_->mNext = mGlobalHead;
+				mGlobalHead = node_;
+				mGlobalCount++;
+			}
+
+		} /// flush
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Allocates Element memory, from Arena bound to calling thread, pool or heap.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pSize - Element size, sizeof(T).
+		  * @return - memory.
+		  * @throws - std::bad_alloc.
+		**/
+		static void * allocate( const size_t pSize )
+		{
+
+			// Arena used while Channel parsed first time.
+			if ( ElementArena::isBound( ) )
+				return( ElementArena::allocate( pSize ) );
+
+#if defined( DEBUG ) || defined( QT_DEBUG ) // DEBUG
+			Q_ASSERT( pSize == sizeof( T ) && "ElementPool::allocate - invalid size !" );
+#endif // DEBUG
+
+			// Memory
+			void * memory_( nullptr );
+
+			// Thread cache
+			Cache & cache_( mCache );
+
+			// Refill empty cache from shared list.
+			if ( cache_.mHead == nullptr )
+				refill( cache_ );
+
+			if ( cache_.mHead != nullptr )
+			{
+				memory_ = cache_.mHead;
+				cache_.mHead = cache_.mHead->mNext;
+				cache_.mCount--;
+				mHits.fetchAndAddRelaxed( 1 );
+			}
+			else
+			{
+				memory_ = ElementArena::allocate( pSize );
+				mMisses.fetchAndAddRelaxed( 1 );
+			}
+
+			// Update high-water mark.
+			const qint64 live_( mLive.fetchAndAddRelaxed( 1 ) + 1 );
+			qint64 highWater_( mHighWater.load( ) );
+			while( live_ > highWater_ && !mHighWater.testAndSetRelaxed( highWater_, live_ ) )
+				highWater_ = mHighWater.load( );
+
+			// Return memory
+			return( memory_ );
+
+		} /// allocate
+
+		/**
+		  * Releases Element memory. Heap memory kept by pool, Arena memory freed with Arena.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pMemory - memory, returned by #allocate, or null.
+		  * @throws - no exceptions.
+		**/
+		static void release( void *const pMemory ) noexcept
+		{
+
+			// Cancel, if null.
+			if ( pMemory == nullptr )
+				return;
+
+			// Arena memory
+			if ( !ElementArena::isHeap( pMemory ) )
+			{
+				ElementArena::release( pMemory );
+				return;
+			}
+
+			mLive.fetchAndSubRelaxed( 1 );
+
+			// Thread cache
+			Cache & cache_( mCache );
+
+			// Keep memory
+			Node *const node_( static_cast<Node*>( pMemory ) );
+			node_->mNext = cache_.mHead;
+			cache_.mHead = node_;
+			cache_.mCount++;
+
+			// Move overflow to shared list.
+			if ( cache_.mCount > CACHE_CAPACITY )
+				flush( cache_, REFILL_COUNT );
+
+		} /// release
+
+		/**
+		  * Returns pool statistics.
+		  *
+		  * @threadsafe - thread-lock used.
+		  * @return - PoolStats.
+		  * @throws - no exceptions.
+		**/
+		static PoolStats getStats( ) noexcept
+		{
+
+			// Stats
+			PoolStats stats_;
+			stats_.mHits = mHits.load( );
+			stats_.mMisses = mMisses.load( );
+			stats_.mLive = mLive.load( );
+			stats_.mHighWater = mHighWater.load( );
+
+			// Lock
+			QMutexLocker lock_( &mMutex );
+
+			stats_.mPooled = mGlobalCount;
+
+			// Return Stats
+			return( stats_ );
+
+		} /// getStats
+
+		// -----------------------------------------------------------
+
+	}; // rss::ElementPool
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// CONSTANTS
+	// ===========================================================
+
+	template <typename T>
+	constexpr int ElementPool<T>::CACHE_CAPACITY;
+
+	template <typename T>
+	constexpr int ElementPool<T>::GLOBAL_CAPACITY;
+
+	template <typename T>
+	constexpr int ElementPool<T>::REFILL_COUNT;
+
+	// ===========================================================
+	// FIELDS
+	// ===========================================================
+
+	template <typename T>
+	thread_local typename ElementPool<T>::Cache ElementPool<T>::mCache;
+
+	template <typename T>
+	QMutex ElementPool<T>::mMutex;
+
+	template <typename T>
+	typename ElementPool<T>::Node * ElementPool<T>::mGlobalHead( nullptr );
+
+	template <typename T>
+	int ElementPool<T>::mGlobalCount( 0 );
+
+	template <typename T>
+	QAtomicInteger<qint64> ElementPool<T>::mHits( 0 );
+
+	template <typename T>
+	QAtomicInteger<qint64> ElementPool<T>::mMisses( 0 );
+
+	template <typename T>
+	QAtomicInteger<qint64> ElementPool<T>::mLive( 0 );
+
+	template <typename T>
+	QAtomicInteger<qint64> ElementPool<T>::mHighWater( 0 );
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_ELEMENT_POOL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_ELEMENT_POOL_HPP
@@ -0,0 +1,1173 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef QRSS_READER_FAST_RSS_SCANNER_HPP
+#include "FastRSSScanner.hpp"
+#endif // !QRSS_READER_FAST_RSS_SCANNER_HPP
+
+// Include rss::SAXRSSHandler
+#ifndef QRSS_READER_SAX_RSS_HANDLER_HPP
+#include "SAXRSSHandler.hpp"
+#endif // !QRSS_READER_SAX_RSS_HANDLER_HPP
+
+// Include rss::RSSTags
+#ifndef QRSS_READER_RSS_TAGS_HPP
+#include "RSSTags.hpp"
+#endif // !QRSS_READER_RSS_TAGS_HPP
+
+// Include rss::CharsetDecoder
+#ifndef QRSS_READER_CHARSET_DECODER_HPP
+#include "CharsetDecoder.hpp"
+#endif // !QRSS_READER_CHARSET_DECODER_HPP
+
+// Include rss::XXHash64
+#ifndef QRSS_READER_XXHASH64_HPP
+#include "XXHash64.hpp"
+#endif // !QRSS_READER_XXHASH64_HPP
+
+// Include C++ string functions (memcmp).
+#include <cstring>
+
+// Include C++ limits.
+#include <limits>
+
+// SIMD
+#if defined( __AVX2__ )
+#define QRSS_READER_FAST_SCANNER_AVX2
+#include <immintrin.h>
+#endif // AVX2
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define QRSS_READER_FAST_SCANNER_SSE2
+#include <emmintrin.h>
+#endif // SSE2
+
+#if defined( _MSC_VER )
+#include <intrin.h> // _BitScanForward
+#endif // MSVC
+
+// ===========================================================
+// rss::FastRSSScanner
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	namespace
+	{
+
+		/**
+		  * Returns index of lowest set bit.
+		  *
+		  * @param pMask - non-zero mask.
+		  * @return - bit index.
+		**/
+		inline unsigned int countTrailingZeros( const unsigned int pMask ) noexcept
+		{
+#if defined( _MSC_VER )
+			unsigned long index_( 0 );
+			_BitScanForward( &index_, pMask );
+			return( static_cast<unsigned int>( index_ ) );
+#else // !MSVC
+			return( static_cast<unsigned int>( __builtin_ctz( pMask ) ) );
+#endif // MSVC
+		}
+
+		/**
+		  * Searches first byte, equal to one of two bytes.
+		  *
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pA - byte to search.
+		  * @param pB - byte to search.
+		  * @return - found byte, or pTo.
+		**/
+		const char * findAny( const char * pFrom, const char *const pTo, const char pA, const char pB ) noexcept
+		{
+
+#if defined( QRSS_READER_FAST_SCANNER_AVX2 )
+			// 32 bytes per step.
+			const __m256i a32_( _mm256_set1_epi8( pA ) );
+			const __m256i b32_( _mm256_set1_epi8( pB ) );
+			while( pTo - pFrom >= 32 )
+			{
+
+				// Compare bytes.
+				const __m256i bytes_( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pFrom ) ) );
+				const unsigned int mask_( static_cast<unsigned int>( _mm256_movemask_epi8( _mm256_or_si256( _mm256_cmpeq_epi8( bytes_, a32_ ), _mm256_cmpeq_epi8( bytes_, b32_ ) ) ) ) );
+
+				// Found
+				if ( mask_ != 0 )
+					return( pFrom + countTrailingZeros( mask_ ) );
+
+				// Next
+				pFrom += 32;
+
+			} /// 32 bytes per step.
+#endif // AVX2
+
+#if defined( QRSS_READER_FAST_SCANNER_SSE2 )
+			// 16 bytes per step.
+			const __m128i a16_( _mm_set1_epi8( pA ) );
+			const __m128i b16_( _mm_set1_epi8( pB ) );
+			while( pTo - pFrom >= 16 )
+			{
+
+				// Compare bytes.
+				const __m128i bytes_( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pFrom ) ) );
+				const unsigned int mask_( static_cast<unsigned int>( _mm_movemask_epi8( _mm_or_si128( _mm_cmpeq_epi8( bytes_, a16_ ), _mm_cmpeq_epi8( bytes_, b16_ ) ) ) ) );
+
+				// Found
+				if ( mask_ != 0 )
+					return( pFrom + countTrailingZeros( mask_ ) );
+
+				// Next
+				pFrom += 16;
+
+			} /// 16 bytes per step.
+#endif // SSE2
+
+			// Tail, or no SIMD.
+			while( pFrom < pTo && *pFrom != pA && *pFrom != pB )
+				pFrom++;
+
+			// Return position.
+			return( pFrom );
+
+		}
+
+		/**
+		  * Searches bytes sequence ("]]>", "-->").
+		  *
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pSequence - bytes to search.
+		  * @param pLength - number of bytes to search.
+		  * @return - sequence start, or pTo.
+		**/
+		const char * findSequence( const char * pFrom, const char *const pTo, const char *const pSequence, const int pLength ) noexcept
+		{
+
+			// Cancel, if too short.
+			if ( pTo - pFrom < pLength )
+				return( pTo );
+
+			// Last possible start.
+			const char *const last_( pTo - pLength + 1 );
+
+			// Search first byte, then compare the rest.
+			while( pFrom < last_ )
+			{
+
+				// Search first byte.
+				pFrom = findAny( pFrom, last_, pSequence[0], pSequence[0] );
+				if ( pFrom == last_ )
+					break;
+
+				// Compare
+				if ( std::memcmp( pFrom, pSequence, static_cast<size_t>( pLength ) ) == 0 )
+					return( pFrom );
+
+				// Next
+				pFrom++;
+
+			} /// Search first byte, then compare the rest.
+
+			// Not found.
+			return( pTo );
+
+		}
+
+		/**
+		  * Checks that bytes start with prefix.
+		  *
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pPrefix - prefix.
+		  * @param pLength - prefix length.
+		  * @return - 'true' if bytes start with prefix.
+		**/
+		inline bool startsWith( const char *const pFrom, const char *const pTo, const char *const pPrefix, const int pLength ) noexcept
+		{ return( pTo - pFrom >= pLength && std::memcmp( pFrom, pPrefix, static_cast<size_t>( pLength ) ) == 0 ); }
+
+		/**
+		  * Checks for Xml white-space.
+		  *
+		  * @param pByte - byte.
+		  * @return - 'true' if white-space.
+		**/
+		inline bool isSpace( const char pByte ) noexcept
+		{ return( pByte == ' ' || pByte == '\n' || pByte == '\t' || pByte == '\r' ); }
+
+		/**
+		  * Checks for end of Element or Attribute Name.
+		  *
+		  * @param pByte - byte.
+		  * @return - 'true' if Name ends.
+		**/
+		inline bool isNameEnd( const char pByte ) noexcept
+		{ return( isSpace( pByte ) || pByte == '>' || pByte == '/' || pByte == '=' ); }
+
+		/**
+		  * Compares ASCII bytes with lower-case name.
+		  *
+		  * @param pFrom - first byte.
+		  * @param pLength - number of bytes.
+		  * @param pName - lower-case name.
+		  * @return - 'true' if equal, ignoring case.
+		**/
+		bool equalsIgnoreCase( const char *const pFrom, const int pLength, const char *const pName ) noexcept
+		{
+
+			// Compare bytes.
+			for( int i = 0; i < pLength; i++ )
+			{
+
+				// Lower-case byte.
+				const char byte_( pFrom[i] >= 'A' && pFrom[i] <= 'Z' ? static_cast<char>( pFrom[i] - 'A' + 'a' ) : pFrom[i] );
+
+				// Compare, name end also differs.
+				if ( byte_ != pName[i] )
+					return( false );
+
+			} /// Compare bytes.
+
+			// Return TRUE, if name ended.
+			return( pName[pLength] == '\0' );
+
+		}
+
+	} // namespace
+
+	// ===========================================================
+	// CONSTANTS
+	// ===========================================================
+
+	constexpr int FastRSSScanner::CHARS_BUFFER_CAPACITY;
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	  * FastRSSScanner constructor.
+	  *
+	  * @param pHandler - RSS Handler.
+	  * @throws - no exceptions.
+	**/
+	FastRSSScanner::FastRSSScanner( rss::SAXRSSHandler *const pHandler ) noexcept
+		: mHandler( pHandler ),
+		  mBegin( nullptr ),
+		  mPos( nullptr ),
+		  mEnd( nullptr ),
+		  mOpenTags( ),
+		  mRootStarted( false ),
+		  mChars( ),
+		  mAttributes( ),
+		  mCharset( nullptr ),
+		  mRecovery( false ),
+		  mItemsDepth( -1 ),
+		  mInItem( false ),
+		  mItemBegin( nullptr ),
+		  mItemName( OpenTag{ nullptr, 0 } )
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Check Handler instance.
+		assert( pHandler != nullptr && "FastRSSScanner::constructor - SAXRSSHandler is null !" );
+#endif // DEBUG
+
+		// Reserve Open Elements. RSS nesting is shallow.
+		mOpenTags.reserve( 16 );
+
+		// Reserve characters buffer once, reused for all Text.
+		mChars.resize( CHARS_BUFFER_CAPACITY );
+
+	}
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	  * FastRSSScanner destructor.
+	  *
+	  * @throws - no exceptions.
+	**/
+	FastRSSScanner::~FastRSSScanner( ) noexcept = default;
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Decodes UTF-8 (or single-byte charset) bytes to characters buffer.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pFrom - first byte.
+	  * @param pTo - end of bytes.
+	  * @param pEntities - 'true' to replace entities (&amp;, &#160;).
+	  * @return - number of characters, or -1 if bytes invalid.
+	  * @throws - no exceptions.
+	**/
+	int FastRSSScanner::decode( const char * pFrom, const char *const pTo, const bool pEntities ) noexcept
+	{
+
+		// Grow buffer. UTF-8 & single-byte charsets never give more UTF-16 characters, than bytes.
+		const int maxLength_( static_cast<int>( pTo - pFrom ) );
+		if ( mChars.size( ) < maxLength_ )
+			mChars.resize( maxLength_ );
+
+		// Decode to buffer.
+		return( CharsetDecoder::decode( pFrom, pTo, pEntities, mCharset, mChars.data( ) ) );
+
+	} /// FastRSSScanner::decode
+
+	/**
+	  * Reads BOM & Xml-declaration.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if supported, 'false' if encoding unsupported.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::scanProlog( ) noexcept
+	{
+
+		// Skip UTF-8 BOM.
+		if ( startsWith( mPos, mEnd, "\xEF\xBB\xBF", 3 ) )
+			mPos += 3;
+
+		// UTF-16 & UTF-32 (BOM or zero bytes) are not supported.
+		if ( mEnd - mPos >= 2 && ( mPos[0] == '\0' || mPos[1] == '\0' || startsWith( mPos, mEnd, "\xFE\xFF", 2 ) || startsWith( mPos, mEnd, "\xFF\xFE", 2 ) ) )
+			return( false );
+
+		// Cancel, if no Xml-declaration.
+		if ( !startsWith( mPos, mEnd, "<?xml", 5 ) || mEnd - mPos < 6 || !isSpace( mPos[5] ) )
+			return( true );
+
+		// Declaration end.
+		const char *const declarationEnd_( findSequence( mPos, mEnd, "?>", 2 ) );
+		if ( declarationEnd_ == mEnd )
+			return( false );
+
+		// Search encoding.
+		const char * pos_( findSequence( mPos, declarationEnd_, "encoding", 8 ) );
+
+		// Check encoding.
+		if ( pos_ != declarationEnd_ )
+		{
+
+			// Skip '='.
+			pos_ += 8;
+			while( pos_ < declarationEnd_ && isSpace( *pos_ ) )
+				pos_++;
+			if ( pos_ >= declarationEnd_ || *pos_ != '=' )
+				return( false );
+			pos_++;
+			while( pos_ < declarationEnd_ && isSpace( *pos_ ) )
+				pos_++;
+
+			// Quote
+			if ( pos_ >= declarationEnd_ || ( *pos_ != '"' && *pos_ != '\'' ) )
+				return( false );
+			const char quote_( *pos_++ );
+
+			// Value
+			const char *const valueEnd_( findAny( pos_, declarationEnd_, quote_, quote_ ) );
+			if ( valueEnd_ == declarationEnd_ )
+				return( false );
+			const int valueLength_( static_cast<int>( valueEnd_ - pos_ ) );
+
+			// UTF-8 & it's ASCII subset, or single-byte charset.
+			if ( equalsIgnoreCase( pos_, valueLength_, "utf-8" ) || equalsIgnoreCase( pos_, valueLength_, "utf8" ) || equalsIgnoreCase( pos_, valueLength_, "us-ascii" ) )
+				mCharset = nullptr;
+			else
+			{
+
+				// Search charset table.
+				mCharset = CharsetDecoder::findTable( pos_, valueLength_ );
+				if ( mCharset == nullptr )
+					return( false );
+
+			} /// UTF-8 & it's ASCII subset, or single-byte charset.
+
+		} /// Check encoding.
+
+		// Move after declaration.
+		mPos = declarationEnd_ + 2;
+
+		// Return TRUE
+		return( true );
+
+	} /// FastRSSScanner::scanProlog
+
+	/**
+	  * Reads Text until next markup.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if OK, 'false' to give up.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::scanText( ) noexcept
+	{
+
+		// Text end.
+		const char *const textEnd_( findAny( mPos, mEnd, '<', '<' ) );
+
+		// Outside root-Element only white-spaces allowed.
+		if ( mOpenTags.isEmpty( ) )
+		{
+			for( const char * pos_ = mPos; pos_ < textEnd_; pos_++ )
+			{
+				if ( !isSpace( *pos_ ) )
+					return( false );
+			}
+		}
+		else if ( mHandler->collectsText( ) )
+		{ // Decode Text, only if Handler uses it.
+
+			// Decode
+			const int length_( decode( mPos, textEnd_, true ) );
+			if ( length_ < 0 )
+				return( false );
+
+			// Forward to Handler.
+			if ( !mHandler->onText( mChars.constData( ), length_ ) )
+				return( false );
+
+		}
+		else if ( !checkEntities( mPos, textEnd_ ) )
+			return( false ); // Skip Text, but check entities, as Qt parser does.
+
+		// Move to markup.
+		mPos = textEnd_;
+
+		// Return TRUE
+		return( true );
+
+	} /// FastRSSScanner::scanText
+
+	/**
+	  * Reads markup, started with '<'.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if OK, 'false' to give up.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::scanMarkup( ) noexcept
+	{
+
+		// Cancel, if truncated.
+		if ( mEnd - mPos < 2 )
+			return( false );
+
+		// Handle markup.
+		switch( mPos[1] )
+		{
+
+		// </element>
+		case '/':
+			return( scanEndTag( ) );
+
+		// <?instruction ?>
+		case '?':
+		{
+
+			// Search end.
+			const char *const end_( findSequence( mPos + 2, mEnd, "?>", 2 ) );
+			if ( end_ == mEnd )
+				return( false );
+
+			// Skip
+			mPos = end_ + 2;
+			return( true );
+
+		} /// <?instruction ?>
+
+		// <!-- -->, <![CDATA[ ]]>, <!DOCTYPE>
+		case '!':
+		{
+
+			// Comment
+			if ( startsWith( mPos, mEnd, "<!--", 4 ) )
+			{
+
+				// Search end.
+				const char *const end_( findSequence( mPos + 4, mEnd, "-->", 3 ) );
+				if ( end_ == mEnd )
+					return( false );
+
+				// Skip
+				mPos = end_ + 3;
+				return( true );
+
+			} /// Comment
+
+			// CDATA
+			if ( startsWith( mPos, mEnd, "<![CDATA[", 9 ) )
+				return( scanCData( ) );
+
+			// DTD is not supported.
+			return( false );
+
+		} /// <!-- -->, <![CDATA[ ]]>, <!DOCTYPE>
+
+		// <element>
+		default:
+			return( scanStartTag( ) );
+
+		} /// Handle markup.
+
+	} /// FastRSSScanner::scanMarkup
+
+	/**
+	  * Reads <element attr="value"> or <element />.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if OK, 'false' to give up.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::scanStartTag( ) noexcept
+	{
+
+		// Only one root-Element allowed.
+		if ( mOpenTags.isEmpty( ) && mRootStarted )
+			return( false );
+
+		// Element start.
+		const char *const tagBegin_( mPos );
+
+		// Element-Name.
+		const char * pos_( mPos + 1 );
+		const char *const name_( pos_ );
+		while( pos_ < mEnd && !isNameEnd( *pos_ ) )
+			pos_++;
+		const int nameLength_( static_cast<int>( pos_ - name_ ) );
+		if ( nameLength_ == 0 )
+			return( false );
+
+		// Resolve Tag.
+		const RSSTag tag_( RSSTags::fromName( name_, nameLength_ ) );
+
+		// Next Item inside open Item, previous Item not closed.
+		if ( mInItem && nameLength_ == mItemName.mLength && std::memcmp( name_, mItemName.mName, static_cast<size_t>( nameLength_ ) ) == 0 )
+			return( false );
+
+		// Item starts, remember it's location for recovery.
+		const bool item_( mRecovery && mHandler->opensItem( tag_ ) );
+		if ( item_ )
+		{
+			mItemsDepth = mOpenTags.size( );
+			mItemBegin = tagBegin_;
+			mItemName = OpenTag{ name_, nameLength_ };
+		}
+
+		// Skip Item, if Handler only indexes Items.
+		if ( mHandler->skipsItem( tag_ ) )
+			return( skipItem( name_, nameLength_ ) );
+
+		// Hash Item bytes. Item, read from the same source before, not built.
+		if ( mHandler->hashesItems( ) && mHandler->opensItem( tag_ ) )
+		{
+
+			// Item end, truncated Item read as usual.
+			const char *const itemEnd_( findItemEnd( name_, nameLength_ ) );
+
+			// Skip known Item.
+			if ( itemEnd_ != nullptr && mHandler->onItemHashed( XXHash64::hash( tagBegin_, static_cast<size_t>( itemEnd_ - tagBegin_ ) ) ) )
+			{
+				mPos = itemEnd_;
+				return( true );
+			}
+
+		} /// Hash Item bytes.
+
+		// Read Attributes, only if Handler uses them.
+		const bool readAttributes_( mHandler->usesAttributes( tag_ ) );
+
+		// Reset Attributes.
+		if ( mAttributes.count( ) > 0 )
+			mAttributes.clear( );
+
+		// 'true' for <element />.
+		bool empty_( false );
+
+		// Attributes
+		for( ;; )
+		{
+
+			// Skip white-spaces.
+			while( pos_ < mEnd && isSpace( *pos_ ) )
+				pos_++;
+
+			// Cancel, if truncated.
+			if ( pos_ >= mEnd )
+				return( false );
+
+			// Element start end.
+			if ( *pos_ == '>' )
+			{
+				pos_++;
+				break;
+			}
+
+			// Empty Element.
+			if ( *pos_ == '/' )
+			{
+
+				// Check '>'.
+				if ( mEnd - pos_ < 2 || pos_[1] != '>' )
+					return( false );
+
+				// Empty
+				pos_ += 2;
+				empty_ = true;
+				break;
+
+			} /// Empty Element.
+
+			// Attribute-Name.
+			const char *const attrName_( pos_ );
+			while( pos_ < mEnd && !isNameEnd( *pos_ ) )
+				pos_++;
+			const int attrNameLength_( static_cast<int>( pos_ - attrName_ ) );
+			if ( attrNameLength_ == 0 )
+				return( false );
+
+			// Skip '='.
+			while( pos_ < mEnd && isSpace( *pos_ ) )
+				pos_++;
+			if ( pos_ >= mEnd || *pos_ != '=' )
+				return( false );
+			pos_++;
+			while( pos_ < mEnd && isSpace( *pos_ ) )
+				pos_++;
+
+			// Quote
+			if ( pos_ >= mEnd || ( *pos_ != '"' && *pos_ != '\'' ) )
+				return( false );
+			const char quote_( *pos_++ );
+
+			// Value end, '<' not allowed in value.
+			const char *const valueEnd_( findAny( pos_, mEnd, quote_, '<' ) );
+			if ( valueEnd_ >= mEnd || *valueEnd_ != quote_ )
+				return( false );
+
+			// Add Attribute.
+			if ( readAttributes_ )
+			{
+
+				// Decode Value.
+				const int valueLength_( decode( pos_, valueEnd_, true ) );
+				if ( valueLength_ < 0 )
+					return( false );
+
+				// Qualified Name.
+				const QString qName_( QString::fromUtf8( attrName_, attrNameLength_ ) );
+
+				// Local Name, without prefix.
+				const int prefixEnd_( qName_.indexOf( QLatin1Char( ':' ) ) );
+
+				// Add
+				mAttributes.append( qName_, QString( ), prefixEnd_ < 0 ? qName_ : qName_.mid( prefixEnd_ + 1 ), QString( mChars.constData( ), valueLength_ ) );
+
+			} /// Add Attribute.
+
+			// Next
+			pos_ = valueEnd_ + 1;
+
+		} /// Attributes
+
+		// Move after Element start.
+		mPos = pos_;
+		mRootStarted = true;
+
+		// Forward to Handler.
+		if ( !mHandler->onStartTag( tag_, mAttributes ) )
+			return( false );
+
+		// Empty Element ends immediately.
+		if ( empty_ )
+			return( mHandler->onEndTag( ) );
+
+		// Add Open Element.
+		mOpenTags.push_back( OpenTag{ name_, nameLength_ } );
+		mInItem = mInItem || item_;
+
+		// Pass raw Text, if Handler decodes it later.
+		if ( mHandler->defersText( 0 ) )
+			return( scanRawText( ) );
+
+		// Return TRUE
+		return( true );
+
+	} /// FastRSSScanner::scanStartTag
+
+	/**
+	  * Searches Item end.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pName - Item Element-Name.
+	  * @param pLength - Element-Name length.
+	  * @return - position after Item end-tag ('>'), or null if Item truncated.
+	  * @throws - no exceptions.
+	**/
+	const char * FastRSSScanner::findItemEnd( const char *const pName, const int pLength ) const noexcept
+	{
+
+		// Search start-tag end, '>' allowed in Attribute values.
+		const char * pos_( pName + pLength );
+		char quote_( '\0' );
+		while( pos_ < mEnd && ( quote_ != '\0' || *pos_ != '>' ) )
+		{
+			if ( *pos_ == '"' || *pos_ == '\'' )
+				quote_ = quote_ == '\0' ? *pos_ : ( quote_ == *pos_ ? '\0' : quote_ );
+			pos_++;
+		}
+
+		// Cancel, if truncated.
+		if ( pos_ >= mEnd )
+			return( nullptr );
+
+		// Search end-tag, if not <item />.
+		if ( pos_[-1] != '/' )
+		{
+
+			// Search markup.
+			for( ;; )
+			{
+
+				// Next markup.
+				pos_ = findAny( pos_, mEnd, '<', '<' );
+				if ( mEnd - pos_ < 2 )
+					return( nullptr );
+
+				// CDATA
+				if ( startsWith( pos_, mEnd, "<![CDATA[", 9 ) )
+				{
+					pos_ = findSequence( pos_ + 9, mEnd, "]]>", 3 );
+					continue;
+				}
+
+				// Comment
+				if ( startsWith( pos_, mEnd, "<!--", 4 ) )
+				{
+					pos_ = findSequence( pos_ + 4, mEnd, "-->", 3 );
+					continue;
+				}
+
+				// Item end-tag.
+				if ( pos_[1] == '/' && mEnd - pos_ - 2 > pLength && std::memcmp( pos_ + 2, pName, static_cast<size_t>( pLength ) ) == 0 && isNameEnd( pos_[2 + pLength] ) )
+				{
+
+					// Search '>'.
+					pos_ = findAny( pos_ + 2 + pLength, mEnd, '>', '>' );
+					if ( pos_ >= mEnd )
+						return( nullptr );
+
+					// Stop
+					break;
+
+				} /// Item end-tag.
+
+				// Next
+				pos_++;
+
+			} /// Search markup.
+
+		} /// Search end-tag, if not <item />.
+
+		// Return position after Item.
+		return( pos_ + 1 );
+
+	} /// FastRSSScanner::findItemEnd
+
+	/**
+	  * Skips Item, which Handler only indexes.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pName - Item Element-Name.
+	  * @param pLength - Element-Name length.
+	  * @return - 'true' if OK, 'false' to give up.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::skipItem( const char *const pName, const int pLength ) noexcept
+	{
+
+		// Item start.
+		const char *const itemBegin_( mPos );
+
+		// Search Item end.
+		const char *const itemEnd_( findItemEnd( pName, pLength ) );
+		if ( itemEnd_ == nullptr )
+			return( false );
+
+		// Move after Item.
+		mPos = itemEnd_;
+
+		// Forward to Handler.
+		return( mHandler->onItemSkipped( static_cast<qint64>( itemBegin_ - mBegin ), static_cast<int>( mPos - itemBegin_ ), mCharset ) );
+
+	} /// FastRSSScanner::skipItem
+
+	/**
+	  * Reads </element>.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if OK, 'false' to give up.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::scanEndTag( ) noexcept
+	{
+
+		// Element-Name.
+		const char * pos_( mPos + 2 );
+		const char *const name_( pos_ );
+		while( pos_ < mEnd && !isNameEnd( *pos_ ) )
+			pos_++;
+		const int nameLength_( static_cast<int>( pos_ - name_ ) );
+
+		// Skip white-spaces.
+		while( pos_ < mEnd && isSpace( *pos_ ) )
+			pos_++;
+
+		// Cancel, if not closed or no Open Element.
+		if ( pos_ >= mEnd || *pos_ != '>' || mOpenTags.isEmpty( ) )
+			return( false );
+
+		// Cancel, if Name differs from Open Element.
+		const OpenTag & openTag_( mOpenTags.last( ) );
+		if ( openTag_.mLength != nameLength_ || std::memcmp( openTag_.mName, name_, static_cast<size_t>( nameLength_ ) ) != 0 )
+			return( false );
+
+		// Close Element.
+		mOpenTags.pop_back( );
+		mPos = pos_ + 1;
+
+		// Item closed.
+		if ( mInItem && mOpenTags.size( ) == mItemsDepth )
+			mInItem = false;
+
+		// Forward to Handler.
+		return( mHandler->onEndTag( ) );
+
+	} /// FastRSSScanner::scanEndTag
+
+	/**
+	  * Reads <![CDATA[ ... ]]>.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if OK, 'false' to give up.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::scanCData( ) noexcept
+	{
+
+		// CDATA bytes.
+		const char *const from_( mPos + 9 );
+		const char *const to_( findSequence( from_, mEnd, "]]>", 3 ) );
+
+		// Cancel, if not closed or outside root-Element.
+		if ( to_ == mEnd || mOpenTags.isEmpty( ) )
+			return( false );
+
+		// Decode Text, only if Handler uses it.
+		if ( mHandler->collectsText( ) )
+		{
+
+			// Decode, no entities in CDATA.
+			const int length_( decode( from_, to_, false ) );
+			if ( length_ < 0 )
+				return( false );
+
+			// Forward to Handler.
+			if ( !mHandler->onText( mChars.constData( ), length_ ) )
+				return( false );
+
+		} /// Decode Text, only if Handler uses it.
+
+		// Move after CDATA.
+		mPos = to_ + 3;
+
+		// Return TRUE
+		return( true );
+
+	} /// FastRSSScanner::scanCData
+
+	/**
+	  * Passes raw content of Element, which Handler decodes on first use (Item Description).
+	  * Content with child Elements, or too long, left for usual scanning.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if OK, 'false' to give up.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::scanRawText( ) noexcept
+	{
+
+		// Content end. CDATA sections & comments are part of content.
+		const char * pos_( mPos );
+		while( true )
+		{
+
+			// Text, entities checked as Qt parser does.
+			const char *const markup_( findAny( pos_, mEnd, '<', '<' ) );
+			if ( !checkEntities( pos_, markup_ ) )
+				return( false );
+			pos_ = markup_;
+
+			// CDATA, or comment.
+			const bool cdata_( startsWith( pos_, mEnd, "<![CDATA[", 9 ) );
+			if ( !cdata_ && !startsWith( pos_, mEnd, "<!--", 4 ) )
+				break;
+
+			// Section end.
+			const char *const sectionEnd_( cdata_ ? findSequence( pos_ + 9, mEnd, "]]>", 3 ) : findSequence( pos_ + 4, mEnd, "-->", 3 ) );
+
+			// Not closed, left for usual scanning.
+			if ( sectionEnd_ == mEnd )
+				return( true );
+
+			// Next
+			pos_ = sectionEnd_ + 3;
+
+		} /// Content end.
+
+		// Content with child Elements, unclosed, or too long.
+		if ( !startsWith( pos_, mEnd, "</", 2 ) || !mHandler->defersText( pos_ - mPos ) || pos_ - mPos > std::numeric_limits<int>::max( ) )
+			return( true );
+
+		// Pass raw content.
+		mHandler->onRawText( mPos, static_cast<int>( pos_ - mPos ), mCharset );
+
+		// Move to end-tag.
+		mPos = pos_;
+
+		// Return TRUE
+		return( true );
+
+	} /// FastRSSScanner::scanRawText
+
+	/**
+	  * Checks entities of Text, as Qt parser does.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pFrom - first byte.
+	  * @param pTo - end of bytes.
+	  * @return - 'true' if all entities known.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::checkEntities( const char *const pFrom, const char *const pTo ) const noexcept
+	{
+
+		// Entity output.
+		QChar entity_[2];
+
+		// Check entities.
+		const char * pos_( findAny( pFrom, pTo, '&', '&' ) );
+		while( pos_ < pTo )
+		{
+
+			// Check Entity.
+			if ( CharsetDecoder::decodeEntity( pos_, pTo, entity_ ) == 0 )
+				return( false );
+
+			// Next
+			pos_ = findAny( pos_, pTo, '&', '&' );
+
+		} /// Check entities.
+
+		// Return TRUE
+		return( true );
+
+	} /// FastRSSScanner::checkEntities
+
+	/**
+	  * Searches next Item start-tag, or Items Parent-Element end-tag.
+	  *
+	  * @brief
+	  * CDATA & comments skipped whole, they can contain markup.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pFrom - first byte.
+	  * @return - position of '<', or document end if not found.
+	  * @throws - no exceptions.
+	**/
+	const char * FastRSSScanner::findItemBoundary( const char * pFrom ) const noexcept
+	{
+
+		// Items Parent-Element.
+		const OpenTag & parent_( mOpenTags[mItemsDepth - 1] );
+
+		// Search markup.
+		for( ;; )
+		{
+
+			// Next markup.
+			pFrom = findAny( pFrom, mEnd, '<', '<' );
+			if ( mEnd - pFrom < 2 )
+				return( mEnd );
+
+			// CDATA
+			if ( startsWith( pFrom, mEnd, "<![CDATA[", 9 ) )
+			{
+				pFrom = findSequence( pFrom + 9, mEnd, "]]>", 3 );
+				continue;
+			}
+
+			// Comment
+			if ( startsWith( pFrom, mEnd, "<!--", 4 ) )
+			{
+				pFrom = findSequence( pFrom + 4, mEnd, "-->", 3 );
+				continue;
+			}
+
+			// Item start-tag.
+			if ( mEnd - pFrom - 1 > mItemName.mLength && std::memcmp( pFrom + 1, mItemName.mName, static_cast<size_t>( mItemName.mLength ) ) == 0 && isNameEnd( pFrom[1 + mItemName.mLength] ) )
+				return( pFrom );
+
+			// Parent-Element end-tag.
+			if ( pFrom[1] == '/' && mEnd - pFrom - 2 > parent_.mLength && std::memcmp( pFrom + 2, parent_.mName, static_cast<size_t>( parent_.mLength ) ) == 0 && isNameEnd( pFrom[2 + parent_.mLength] ) )
+				return( pFrom );
+
+			// Next
+			pFrom++;
+
+		} /// Search markup.
+
+	} /// FastRSSScanner::findItemBoundary
+
+	/**
+	  * Drops malformed Item (or bytes between Items) in recovery mode.
+	  * Scanning continues from the next Item boundary.
+	  *
+	  * (?) Error inside Item drops whole Item. Error between Items drops bytes
+	  * up to the next Item. At document end open Elements closed, so Items
+	  * of truncated document kept.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if recovered, 'false' to give up.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::recover( ) noexcept
+	{
+
+		// Cancel, if not recovering, parsing stopped by Handler, or error not at Items level.
+		if ( !mRecovery || mItemsDepth < 1 || mOpenTags.size( ) < mItemsDepth || mHandler->getExceededLimit( ) != ParseLimits::NO_LIMIT )
+			return( false );
+
+		// Dropped bytes start: Item start, or error position between Items.
+		const char *const dropBegin_( mInItem ? mItemBegin : mPos );
+
+		// Next Item boundary. Between Items error position itself skipped, so scanning always moves on.
+		const char *const next_( findItemBoundary( mInItem || mPos >= mEnd ? mPos : mPos + 1 ) );
+
+		// Drop Item, continue from Items Parent-Element.
+		mOpenTags.resize( mItemsDepth );
+		mInItem = false;
+		mHandler->onRecovered( mItemsDepth, static_cast<qint64>( dropBegin_ - mBegin ), static_cast<qint64>( next_ - dropBegin_ ) );
+		mPos = next_;
+
+		// Document end, close open Elements.
+		while( mPos >= mEnd && !mOpenTags.isEmpty( ) )
+		{
+
+			// Close Element.
+			mOpenTags.pop_back( );
+
+			// Forward to Handler.
+			if ( !mHandler->onEndTag( ) )
+				return( false );
+
+		} /// Document end, close open Elements.
+
+		// Return TRUE
+		return( true );
+
+	} /// FastRSSScanner::recover
+
+	/**
+	  * Parse RSS-document from memory.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pData - Document bytes.
+	  * @param pSize - number of bytes.
+	  * @param pCharset - table of single-byte charset, used if bytes have no Xml-declaration (indexed Item), null for UTF-8.
+	  * @return - 'true' if document parsed (malformed Items dropped in recovery mode), 'false' if unsupported or malformed.
+	  * @throws - no exceptions.
+	**/
+	bool FastRSSScanner::parse( const char *const pData, const qint64 pSize, const ushort *const pCharset ) noexcept
+	{
+
+		// Cancel, if no data, or too large for QString.
+		if ( pData == nullptr || pSize <= 0 || pSize > std::numeric_limits<int>::max( ) )
+			return( false );
+
+		// Reset
+		mBegin = pData;
+		mPos = pData;
+		mEnd = pData + pSize;
+		mOpenTags.resize( 0 );
+		mRootStarted = false;
+		mRecovery = mHandler->recovers( );
+		mItemsDepth = -1;
+		mInItem = false;
+
+		// Check encoding. Xml-declaration overrides given charset.
+		mCharset = pCharset;
+		if ( !scanProlog( ) )
+			return( false );
+
+		// Read Text & markup.
+		while( mPos < mEnd )
+		{
+
+			// Read
+			const bool result_( *mPos == '<' ? scanMarkup( ) : scanText( ) );
+
+			// Give up, unless malformed Item dropped.
+			if ( !result_ && !recover( ) )
+				return( false );
+
+		} /// Read Text & markup.
+
+		// Truncated document, drop unclosed Item.
+		if ( mRootStarted && !mOpenTags.isEmpty( ) && !recover( ) )
+			return( false );
+
+		// Return TRUE, if root-Element closed.
+		return( mRootStarted && mOpenTags.isEmpty( ) );
+
+	} /// FastRSSScanner::parse
+
+	// -----------------------------------------------------------
+
+} // rss
+
+// -----------------------------------------------------------
@@ -0,0 +1,368 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_FAST_RSS_SCANNER_HPP
+#define QRSS_READER_FAST_RSS_SCANNER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QString
+#ifndef QSTRING_H
+#include <qstring.h>
+#endif // !QSTRING_H
+
+// Include QVector
+#ifndef QVECTOR_H
+#include <qvector.h>
+#endif // !QVECTOR_H
+
+// Include QtXml
+#include <QtXml> // QXmlAttributes
+
+// ===========================================================
+// FORWARD-DECLARATIONS
+// ===========================================================
+
+// Forward-declare rss::SAXRSSHandler
+#ifndef QRSS_READER_SAX_RSS_HANDLER_DECL
+#define QRSS_READER_SAX_RSS_HANDLER_DECL
+namespace rss { class SAXRSSHandler; }
+#endif // !QRSS_READER_SAX_RSS_HANDLER_DECL
+
+// ===========================================================
+// rss::FastRSSScanner
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * FastRSSScanner - hand-written scanner for well-formed UTF-8 RSS & Atom documents.
+	  *
+	  * @brief
+	  * Reads document from memory (mapped File), searches markup ('<', '&', ']]>')
+	  * with SSE2 (AVX2, if compiler targets it), 16/32 bytes per step.
+	  * Element-Names resolved from bytes, Text decoded only for Elements
+	  * which SAXRSSHandler collects, Attributes only for Elements which use them.
+	  * Item Description passed raw (rss::Text decodes it on first use).
+	  * Events forwarded to the same SAXRSSHandler, so all engines fill the same
+	  * rss::Channel & rss::Item objects.
+	  * Scanner gives up (#parse returns 'false') on anything it doesn't support:
+	  * DTD, encodings other than UTF-8/ASCII & rss::CharsetDecoder single-byte charsets,
+	  * unknown entities, malformed markup.
+	  * Caller must then discard Handler results & use Qt parser.
+	  * If Handler indexes Items, Item bytes only searched for end-tag.
+	  * If Handler hashes Items, Item bytes hashed (xxHash64) & Items, known by Handler, skipped.
+	  * In Handler recovery mode, malformed Item (or truncated document tail) dropped
+	  * & scanning continues from the next Item, or Items Parent-Element end.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	class FastRSSScanner final
+	{
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// OpenTag
+		// ===========================================================
+
+		/** Open Element-Name, points to document bytes. **/
+		struct OpenTag
+		{
+
+			/** Name bytes. **/
+			const char * mName;
+
+			/** Number of bytes. **/
+			int mLength;
+
+		}; /// OpenTag
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Initial capacity of decoded-characters buffer. **/
+		static constexpr int CHARS_BUFFER_CAPACITY = 4096;
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** RSS Handler to forward parsing events to. **/
+		rss::SAXRSSHandler *const mHandler;
+
+		/** Document start. Item offsets counted from it. **/
+		const char * mBegin;
+
+		/** Current position. **/
+		const char * mPos;
+
+		/** Document end. **/
+		const char * mEnd;
+
+		/** Open Elements, to check end-tags. **/
+		QVector<OpenTag> mOpenTags;
+
+		/** 'true' when root-Element started. **/
+		bool mRootStarted;
+
+		/** Decoded characters. Reused for all Text & Attributes. **/
+		QString mChars;
+
+		/** Attributes. Reused for every Element to avoid allocations. **/
+		QXmlAttributes mAttributes;
+
+		/** Table of single-byte charset (windows-1251, KOI8-R, ISO-8859-*), null for UTF-8. **/
+		const ushort * mCharset;
+
+		/** 'true' if malformed Items dropped (Handler recovery mode). **/
+		bool mRecovery;
+
+		/** Number of open Elements, when Item started (Items Parent-Element depth), -1 before first Item. **/
+		int mItemsDepth;
+
+		/** 'true' while Item open. **/
+		bool mInItem;
+
+		/** Start of last Item. **/
+		const char * mItemBegin;
+
+		/** Element-Name of last Item. **/
+		OpenTag mItemName;
+
+		// ===========================================================
+		// DELETED CONSTRUCTORS & OPERATORS
+		// ===========================================================
+
+		/** @deleted FastRSSScanner const copy constructor. **/
+		FastRSSScanner( const FastRSSScanner & ) noexcept = delete;
+
+		/** @deleted FastRSSScanner copy-assignment operator. **/
+		FastRSSScanner & operator=( const FastRSSScanner & ) noexcept = delete;
+
+		/** @deleted FastRSSScanner move constructor. **/
+		FastRSSScanner( FastRSSScanner && ) noexcept = delete;
+
+		/** @deleted FastRSSScanner move assignment operator. **/
+		FastRSSScanner & operator=( FastRSSScanner && ) noexcept = delete;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Reads BOM & Xml-declaration.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if supported, 'false' if encoding unsupported.
+		  * @throws - no exceptions.
+		**/
+		bool scanProlog( ) noexcept;
+
+		/**
+		  * Reads Text until next markup.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if OK, 'false' to give up.
+		  * @throws - no exceptions.
+		**/
+		bool scanText( ) noexcept;
+
+		/**
+		  * Reads markup, started with '<'.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if OK, 'false' to give up.
+		  * @throws - no exceptions.
+		**/
+		bool scanMarkup( ) noexcept;
+
+		/**
+		  * Reads <element attr="value"> or <element />.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if OK, 'false' to give up.
+		  * @throws - no exceptions.
+		**/
+		bool scanStartTag( ) noexcept;
+
+		/**
+		  * Skips Item, which Handler only indexes.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pName - Item Element-Name.
+		  * @param pLength - Element-Name length.
+		  * @return - 'true' if OK, 'false' to give up.
+		  * @throws - no exceptions.
+		**/
+		bool skipItem( const char *const pName, const int pLength ) noexcept;
+
+		/**
+		  * Searches Item end.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pName - Item Element-Name.
+		  * @param pLength - Element-Name length.
+		  * @return - position after Item end-tag ('>'), or null if Item truncated.
+		  * @throws - no exceptions.
+		**/
+		const char * findItemEnd( const char *const pName, const int pLength ) const noexcept;
+
+		/**
+		  * Reads </element>.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if OK, 'false' to give up.
+		  * @throws - no exceptions.
+		**/
+		bool scanEndTag( ) noexcept;
+
+		/**
+		  * Reads <![CDATA[ ... ]]>.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if OK, 'false' to give up.
+		  * @throws - no exceptions.
+		**/
+		bool scanCData( ) noexcept;
+
+		/**
+		  * Passes raw content of Element, which Handler decodes on first use (Item Description).
+		  * Content with child Elements, or too long, left for usual scanning.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if OK, 'false' to give up.
+		  * @throws - no exceptions.
+		**/
+		bool scanRawText( ) noexcept;
+
+		/**
+		  * Checks entities of Text, as Qt parser does.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @return - 'true' if all entities known.
+		  * @throws - no exceptions.
+		**/
+		bool checkEntities( const char *const pFrom, const char *const pTo ) const noexcept;
+
+		/**
+		  * Decodes UTF-8 (or single-byte charset) bytes to characters buffer.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pFrom - first byte.
+		  * @param pTo - end of bytes.
+		  * @param pEntities - 'true' to replace entities (&amp;, &#160;).
+		  * @return - number of characters, or -1 if bytes invalid.
+		  * @throws - no exceptions.
+		**/
+		int decode( const char * pFrom, const char *const pTo, const bool pEntities ) noexcept;
+
+		/**
+		  * Searches next Item start-tag, or Items Parent-Element end-tag.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pFrom - first byte.
+		  * @return - position of '<', or document end if not found.
+		  * @throws - no exceptions.
+		**/
+		const char * findItemBoundary( const char * pFrom ) const noexcept;
+
+		/**
+		  * Drops malformed Item (or bytes between Items) in recovery mode.
+		  * Scanning continues from the next Item boundary.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if recovered, 'false' to give up.
+		  * @throws - no exceptions.
+		**/
+		bool recover( ) noexcept;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		  * FastRSSScanner constructor.
+		  *
+		  * @param pHandler - RSS Handler.
+		  * @throws - no exceptions.
+		**/
+		explicit FastRSSScanner( rss::SAXRSSHandler *const pHandler ) noexcept;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		  * FastRSSScanner destructor.
+		  *
+		  * @throws - no exceptions.
+		**/
+		~FastRSSScanner( ) noexcept;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Parse RSS-document from memory.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pData - Document bytes.
+		  * @param pSize - number of bytes.
+		  * @param pCharset - table of single-byte charset, used if bytes have no Xml-declaration (indexed Item), null for UTF-8.
+		  * @return - 'true' if document parsed (malformed Items dropped in recovery mode), 'false' if unsupported or malformed.
+		  * @throws - no exceptions.
+		**/
+		bool parse( const char *const pData, const qint64 pSize, const ushort *const pCharset = nullptr ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // rss::FastRSSScanner
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_FAST_RSS_SCANNER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_FAST_RSS_SCANNER_HPP
@@ -0,0 +1,431 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef QRSS_READER_GZIP_DEVICE_HPP
+#include "GzipDevice.hpp"
+#endif // !QRSS_READER_GZIP_DEVICE_HPP
+
+// Include zlib
+#include <zlib.h>
+
+// Include C++ limits.
+#include <limits>
+
+// DEBUG
+#if defined( QT_DEBUG ) || defined( DEBUG )
+
+// Include qDebug
+#include <qdebug.h>
+
+#endif // DEBUG
+
+// ===========================================================
+// rss::GzipDevice
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// CONSTANTS
+	// ===========================================================
+
+	constexpr int GzipDevice::INPUT_BUFFER_SIZE;
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	  * GzipDevice constructor.
+	  *
+	  * @param pSource - opened device with compressed bytes. Not owned.
+	  * @param pFormat - compressed stream Format.
+	  * @throws - no exceptions.
+	**/
+	GzipDevice::GzipDevice( QIODevice *const pSource, const Format pFormat ) noexcept
+		: QIODevice( ),
+		  mSource( pSource ),
+		  mFormat( pFormat ),
+		  mStream( nullptr ),
+		  mInput( ),
+		  mFinished( false ),
+		  mSizeLimit( 0 ),
+		  mInflated( 0 ),
+		  mSizeLimitReached( false )
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Check source device.
+		assert( pSource != nullptr && "GzipDevice::constructor - source device is null !" );
+#endif // DEBUG
+
+	}
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	  * GzipDevice destructor.
+	  *
+	  * @throws - no exceptions.
+	**/
+	GzipDevice::~GzipDevice( ) noexcept
+	{ releaseStream( ); }
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Reads next compressed chunk from source.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - number of bytes read, 0 at source end, -1 if error.
+	  * @throws - no exceptions.
+	**/
+	qint64 GzipDevice::fillInput( ) noexcept
+	{
+
+		// Read chunk.
+		const qint64 size_( mSource->read( mInput.data( ), INPUT_BUFFER_SIZE ) );
+
+		// Pass chunk to zlib.
+		if ( size_ > 0 )
+		{
+			mStream->next_in = reinterpret_cast<Bytef*>( mInput.data( ) );
+			mStream->avail_in = static_cast<uInt>( size_ );
+		}
+
+		// Return size.
+		return( size_ );
+
+	} /// GzipDevice::fillInput
+
+	/**
+	  * Releases zlib stream.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void GzipDevice::releaseStream( ) noexcept
+	{
+
+		// Cancel, if not opened.
+		if ( mStream == nullptr )
+			return;
+
+		// Release zlib state.
+		inflateEnd( mStream );
+		delete mStream;
+		mStream = nullptr;
+
+		// Release buffer.
+		mInput.clear( );
+
+	} /// GzipDevice::releaseStream
+
+	/**
+	  * Detects Format of compressed File.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pSource - opened device, bytes only peeked.
+	  * @param pFileName - File-Name, used for raw deflate.
+	  * @return - Format, NONE_FORMAT if not compressed.
+	  * @throws - no exceptions.
+	**/
+	GzipDevice::Format GzipDevice::detectFormat( QIODevice & pSource, const QString & pFileName ) noexcept
+	{
+
+		// Raw deflate has no header.
+		if ( pFileName.endsWith( ".deflate", Qt::CaseInsensitive ) )
+			return( DEFLATE_FORMAT );
+
+		// Read header.
+		const QByteArray header_( pSource.peek( 2 ) );
+
+		// Cancel, if too short.
+		if ( header_.size( ) < 2 )
+			return( NONE_FORMAT );
+
+		// Header bytes.
+		const unsigned int byte0_( static_cast<unsigned char>( header_.at( 0 ) ) );
+		const unsigned int byte1_( static_cast<unsigned char>( header_.at( 1 ) ) );
+
+		// gzip magic.
+		if ( byte0_ == 0x1Fu && byte1_ == 0x8Bu )
+			return( GZIP_FORMAT );
+
+		// zlib header: deflate method & check-bits. Xml ('<', BOM) never matches.
+		if ( ( byte0_ & 0x0Fu ) == 8u && ( ( byte0_ << 8 ) | byte1_ ) % 31u == 0u )
+			return( ZLIB_FORMAT );
+
+		// Not compressed.
+		return( NONE_FORMAT );
+
+	} /// GzipDevice::detectFormat
+
+	/**
+	  * Limits number of inflated bytes. Device ends, when limit reached.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pMaxBytes - max number of bytes, 0 if not limited.
+	  * @throws - no exceptions.
+	**/
+	void GzipDevice::setSizeLimit( const qint64 pMaxBytes ) noexcept
+	{ mSizeLimit = pMaxBytes; }
+
+	/**
+	  * Returns 'true' if inflating stopped by size limit.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool GzipDevice::isSizeLimitReached( ) const noexcept
+	{ return( mSizeLimitReached ); }
+
+	// ===========================================================
+	// OVERRIDE: QIODevice
+	// ===========================================================
+
+	/**
+	  * Opens device, read-only mode only.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pMode - open mode.
+	  * @return - 'true' if opened.
+	  * @throws - no exceptions.
+	**/
+	bool GzipDevice::open( QIODevice::OpenMode pMode )
+	{
+
+		// Cancel, if write requested, or already opened.
+		if ( ( pMode & QIODevice::WriteOnly ) != 0 || mStream != nullptr )
+			return( false );
+
+		// Create zlib state.
+		mStream = new z_stream( );
+		mStream->zalloc = Z_NULL;
+		mStream->zfree = Z_NULL;
+		mStream->opaque = Z_NULL;
+		mStream->next_in = Z_NULL;
+		mStream->avail_in = 0;
+
+		// Window bits select stream header.
+		const int windowBits_( mFormat == GZIP_FORMAT ? 16 + MAX_WBITS : ( mFormat == DEFLATE_FORMAT ? -MAX_WBITS : MAX_WBITS ) );
+
+		// Init inflate.
+		if ( inflateInit2( mStream, windowBits_ ) != Z_OK )
+		{
+			delete mStream;
+			mStream = nullptr;
+			return( false );
+		}
+
+		// Allocate buffer once.
+		mInput.resize( INPUT_BUFFER_SIZE );
+		mFinished = false;
+		mInflated = 0;
+		mSizeLimitReached = false;
+
+		// Open
+		return( QIODevice::open( pMode ) );
+
+	} /// GzipDevice::open
+
+	/**
+	  * Closes device. Source device not closed.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void GzipDevice::close( )
+	{
+
+		// Close
+		QIODevice::close( );
+
+		// Release zlib state.
+		releaseStream( );
+
+	} /// GzipDevice::close
+
+	/**
+	  * Returns 'true', inflated bytes can't be seeked.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool GzipDevice::isSequential( ) const
+	{ return( true ); }
+
+	/**
+	  * Returns 'true' when all bytes inflated & read.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool GzipDevice::atEnd( ) const
+	{ return( mFinished && QIODevice::atEnd( ) ); }
+
+	/**
+	  * Inflates bytes to reader's buffer.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pData - output buffer.
+	  * @param pMaxSize - buffer size.
+	  * @return - number of bytes, 0 at end, -1 if compressed data is invalid.
+	  * @throws - no exceptions.
+	**/
+	qint64 GzipDevice::readData( char * pData, qint64 pMaxSize )
+	{
+
+		// Cancel, if closed or all bytes inflated.
+		if ( mStream == nullptr || mFinished || pMaxSize <= 0 )
+			return( 0 );
+
+		// Stop at size limit, as if stream ended.
+		if ( mSizeLimit > 0 && mInflated >= mSizeLimit )
+		{
+			mSizeLimitReached = true;
+			mFinished = true;
+			return( 0 );
+		}
+
+		// Bytes left before size limit.
+		const qint64 maxSize_( mSizeLimit > 0 ? qMin( pMaxSize, mSizeLimit - mInflated ) : pMaxSize );
+
+		// Output size, limited by zlib counter.
+		const uInt outputSize_( static_cast<uInt>( qMin( maxSize_, static_cast<qint64>( std::numeric_limits<uInt>::max( ) ) ) ) );
+
+		// Set output.
+		mStream->next_out = reinterpret_cast<Bytef*>( pData );
+		mStream->avail_out = outputSize_;
+
+		// Inflate until output full.
+		while( mStream->avail_out > 0 )
+		{
+
+			// Read compressed chunk.
+			if ( mStream->avail_in == 0 )
+			{
+
+				// Read
+				const qint64 readSize_( fillInput( ) );
+
+				// Source ended before compressed stream end.
+				if ( readSize_ <= 0 )
+				{
+
+					// Return inflated bytes, error reported with next call.
+					const qint64 inflated_( static_cast<qint64>( outputSize_ - mStream->avail_out ) );
+					mInflated += inflated_;
+					if ( inflated_ > 0 )
+						return( inflated_ );
+
+					// Error
+					setErrorString( "GzipDevice - compressed data truncated" );
+					mFinished = true;
+					return( -1 );
+
+				} /// Source ended before compressed stream end.
+
+			} /// Read compressed chunk.
+
+			// Inflate
+			const int status_( inflate( mStream, Z_NO_FLUSH ) );
+
+			// Stream end.
+			if ( status_ == Z_STREAM_END )
+			{
+
+				// gzip File can contain several members, other Formats end here.
+				if ( mFormat != GZIP_FORMAT || ( mStream->avail_in == 0 && fillInput( ) <= 0 ) )
+				{
+					mFinished = true;
+					break;
+				}
+
+				// Next gzip member.
+				inflateReset( mStream );
+				continue;
+
+			} /// Stream end.
+
+			// Invalid data.
+			if ( status_ != Z_OK )
+			{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+				// Debug
+				qDebug( ) << "GzipDevice::readData - inflate error " << status_;
+#endif // DEBUG
+
+				// Error
+				setErrorString( "GzipDevice - invalid compressed data" );
+				mFinished = true;
+				return( -1 );
+
+			} /// Invalid data.
+
+		} /// Inflate until output full.
+
+		// Number of inflated bytes.
+		const qint64 inflated_( static_cast<qint64>( outputSize_ - mStream->avail_out ) );
+		mInflated += inflated_;
+
+		// Return number of inflated bytes.
+		return( inflated_ );
+
+	} /// GzipDevice::readData
+
+	/**
+	  * Not supported, device is read-only.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @return - -1.
+	  * @throws - no exceptions.
+	**/
+	qint64 GzipDevice::writeData( const char * pData, qint64 pSize )
+	{
+
+		Q_UNUSED( pData );
+		Q_UNUSED( pSize );
+
+		// Return -1
+		return( -1 );
+
+	} /// GzipDevice::writeData
+
+	// -----------------------------------------------------------
+
+} // rss
+
+// -----------------------------------------------------------
@@ -0,0 +1,318 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_GZIP_DEVICE_HPP
+#define QRSS_READER_GZIP_DEVICE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QIODevice
+#ifndef QIODEVICE_H
+#include <QIODevice>
+#endif // !QIODEVICE_H
+
+// Include QByteArray
+#ifndef QBYTEARRAY_H
+#include <QByteArray>
+#endif // !QBYTEARRAY_H
+
+// ===========================================================
+// FORWARD-DECLARATIONS
+// ===========================================================
+
+// Forward-declare z_stream (zlib.h included only by GzipDevice.cpp)
+struct z_stream_s;
+
+// ===========================================================
+// rss::GzipDevice
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * GzipDevice - read-only sequential device, inflates compressed RSS-file.
+	  *
+	  * @brief
+	  * Compressed bytes read from source device by INPUT_BUFFER_SIZE chunks,
+	  * inflated directly to reader's buffer. Whole document never stored in memory,
+	  * so Qt parsers (SAX, pull-parser) read Feed while it's decompressed.
+	  * Supports gzip (.gz, concatenated members too), zlib & raw deflate streams.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	class GzipDevice final : public QIODevice
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// Format
+		// ===========================================================
+
+		/** Compressed stream Format. **/
+		enum Format
+		{
+
+			/** Not compressed. **/
+			NONE_FORMAT = 0,
+
+			/** gzip (RFC 1952), magic bytes 1F 8B. **/
+			GZIP_FORMAT = 1,
+
+			/** zlib (RFC 1950), 78 XX header. **/
+			ZLIB_FORMAT = 2,
+
+			/** raw deflate (RFC 1951), no header, detected by ".deflate" suffix. **/
+			DEFLATE_FORMAT = 3
+
+		}; // Format
+
+		// -----------------------------------------------------------
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Size of compressed-bytes buffer. **/
+		static constexpr int INPUT_BUFFER_SIZE = 64 * 1024;
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Source device with compressed bytes. **/
+		QIODevice *const mSource;
+
+		/** Format. **/
+		const Format mFormat;
+
+		/** zlib stream state, null if device closed. **/
+		z_stream_s * mStream;
+
+		/** Compressed bytes, read from source. **/
+		QByteArray mInput;
+
+		/** 'true' when last compressed stream ended & source has no more bytes. **/
+		bool mFinished;
+
+		/** Max number of inflated bytes, 0 if not limited. **/
+		qint64 mSizeLimit;
+
+		/** Number of inflated bytes. **/
+		qint64 mInflated;
+
+		/** 'true' if inflating stopped by size limit. **/
+		bool mSizeLimitReached;
+
+		// ===========================================================
+		// DELETED CONSTRUCTORS & OPERATORS
+		// ===========================================================
+
+		/** @deleted GzipDevice const copy constructor. **/
+		GzipDevice( const GzipDevice & ) noexcept = delete;
+
+		/** @deleted GzipDevice copy-assignment operator. **/
+		GzipDevice & operator=( const GzipDevice & ) noexcept = delete;
+
+		/** @deleted GzipDevice move constructor. **/
+		GzipDevice( GzipDevice && ) noexcept = delete;
+
+		/** @deleted GzipDevice move assignment operator. **/
+		GzipDevice & operator=( GzipDevice && ) noexcept = delete;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Reads next compressed chunk from source.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - number of bytes read, 0 at source end, -1 if error.
+		  * @throws - no exceptions.
+		**/
+		qint64 fillInput( ) noexcept;
+
+		/**
+		  * Releases zlib stream.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		void releaseStream( ) noexcept;
+
+		// -----------------------------------------------------------
+
+	protected:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// OVERRIDE: QIODevice
+		// ===========================================================
+
+		/**
+		  * Inflates bytes to reader's buffer.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pData - output buffer.
+		  * @param pMaxSize - buffer size.
+		  * @return - number of bytes, 0 at end, -1 if compressed data is invalid.
+		  * @throws - no exceptions.
+		**/
+		virtual qint64 readData( char * pData, qint64 pMaxSize ) override;
+
+		/**
+		  * Not supported, device is read-only.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @return - -1.
+		  * @throws - no exceptions.
+		**/
+		virtual qint64 writeData( const char * pData, qint64 pSize ) override;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		  * GzipDevice constructor.
+		  *
+		  * @param pSource - opened device with compressed bytes. Not owned.
+		  * @param pFormat - compressed stream Format.
+		  * @throws - no exceptions.
+		**/
+		explicit GzipDevice( QIODevice *const pSource, const Format pFormat ) noexcept;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		  * GzipDevice destructor.
+		  *
+		  * @throws - no exceptions.
+		**/
+		virtual ~GzipDevice( ) noexcept override;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Detects Format of compressed File.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pSource - opened device, bytes only peeked.
+		  * @param pFileName - File-Name, used for raw deflate.
+		  * @return - Format, NONE_FORMAT if not compressed.
+		  * @throws - no exceptions.
+		**/
+		static Format detectFormat( QIODevice & pSource, const QString & pFileName ) noexcept;
+
+		/**
+		  * Limits number of inflated bytes. Device ends, when limit reached.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pMaxBytes - max number of bytes, 0 if not limited.
+		  * @throws - no exceptions.
+		**/
+		void setSizeLimit( const qint64 pMaxBytes ) noexcept;
+
+		/**
+		  * Returns 'true' if inflating stopped by size limit.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		bool isSizeLimitReached( ) const noexcept;
+
+		// ===========================================================
+		// OVERRIDE: QIODevice
+		// ===========================================================
+
+		/**
+		  * Opens device, read-only mode only.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pMode - open mode.
+		  * @return - 'true' if opened.
+		  * @throws - no exceptions.
+		**/
+		virtual bool open( QIODevice::OpenMode pMode ) override;
+
+		/**
+		  * Closes device. Source device not closed.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		virtual void close( ) override;
+
+		/**
+		  * Returns 'true', inflated bytes can't be seeked.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @throws - no exceptions.
+		**/
+		virtual bool isSequential( ) const override;
+
+		/**
+		  * Returns 'true' when all bytes inflated & read.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		virtual bool atEnd( ) const override;
+
+		// -----------------------------------------------------------
+
+	}; // rss::GzipDevice
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_GZIP_DEVICE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_GZIP_DEVICE_HPP
@@ -0,0 +1,140 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_PARSE_DIAGNOSTICS_HPP
+#define QRSS_READER_PARSE_DIAGNOSTICS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QString
+#ifndef QSTRING_H
+#include <qstring.h>
+#endif // !QSTRING_H
+
+// Include QVector
+#ifndef QVECTOR_H
+#include <qvector.h>
+#endif // !QVECTOR_H
+
+// ===========================================================
+// rss::ParseDiagnostics
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * ParseDiagnostics - problems found while one RSS-document parsed.
+	  *
+	  * @brief
+	  * In recovery mode malformed Items are dropped & parsing continues
+	  * from the next Item, dropped bytes reported as recovered Regions.
+	  * Error, which stopped parsing, reported with it's position.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	struct ParseDiagnostics final
+	{
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// Region
+		// ===========================================================
+
+		/** Dropped document bytes. **/
+		struct Region
+		{
+
+			/** Offset of first byte. **/
+			qint64 mOffset;
+
+			/** Number of bytes. **/
+			qint64 mLength;
+
+		}; /// Region
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Regions dropped in recovery mode, in document order. **/
+		QVector<Region> mRecovered;
+
+		/** Message of error, which stopped parsing. Empty if none. **/
+		QString mError;
+
+		/** Line of error, -1 if unknown. **/
+		int mErrorLine;
+
+		/** Column of error, -1 if unknown. **/
+		int mErrorColumn;
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		  * ParseDiagnostics constructor.
+		  *
+		  * @throws - no exceptions.
+		**/
+		ParseDiagnostics( ) noexcept
+			: mRecovered( ),
+			  mError( ),
+			  mErrorLine( -1 ),
+			  mErrorColumn( -1 )
+		{
+		}
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Returns 'true' if no problems found.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		bool isEmpty( ) const noexcept
+		{ return( mRecovered.isEmpty( ) && mError.isEmpty( ) ); }
+
+		// -----------------------------------------------------------
+
+	}; // rss::ParseDiagnostics
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_PARSE_DIAGNOSTICS_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_PARSE_DIAGNOSTICS_HPP
@@ -0,0 +1,138 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_PARSE_LIMITS_HPP
+#define QRSS_READER_PARSE_LIMITS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QtGlobal
+#ifndef QGLOBAL_H
+#include <qglobal.h>
+#endif // !QGLOBAL_H
+
+// ===========================================================
+// rss::ParseLimits
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * ParseLimits - bounds of one RSS-document parsing.
+	  *
+	  * @brief
+	  * When any limit reached, parsing stops & Items accepted so far are kept,
+	  * so broken (or malicious) Feed can't lock GUI-thread or use all memory.
+	  * 0 means no limit.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	struct ParseLimits final
+	{
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// LimitType
+		// ===========================================================
+
+		/** Limit, which stopped parsing. **/
+		enum LimitType
+		{
+
+			/** No limit reached. **/
+			NO_LIMIT = 0,
+
+			/** Document size. **/
+			BYTES_LIMIT = 1,
+
+			/** Number of Items. **/
+			ITEMS_LIMIT = 2,
+
+			/** Length of Element Text. **/
+			TEXT_LENGTH_LIMIT = 3,
+
+			/** Elements nesting depth. **/
+			DEPTH_LIMIT = 4,
+
+			/** Wall-clock time. **/
+			TIME_LIMIT = 5
+
+		}; // LimitType
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Max number of document bytes (inflated, for compressed Files). **/
+		qint64 mMaxBytes;
+
+		/** Max number of Items. **/
+		int mMaxItems;
+
+		/** Max number of characters in Element Text. **/
+		int mMaxTextLength;
+
+		/** Max Elements nesting depth. **/
+		int mMaxDepth;
+
+		/** Max parsing time, in milliseconds. **/
+		qint64 mTimeBudget;
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		  * ParseLimits constructor. No limits set.
+		  *
+		  * @throws - no exceptions.
+		**/
+		ParseLimits( ) noexcept
+			: mMaxBytes( 0 ),
+			  mMaxItems( 0 ),
+			  mMaxTextLength( 0 ),
+			  mMaxDepth( 0 ),
+			  mTimeBudget( 0 )
+		{
+		}
+
+		// -----------------------------------------------------------
+
+	}; // rss::ParseLimits
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_PARSE_LIMITS_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_PARSE_LIMITS_HPP
@@ -0,0 +1,205 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_PARSE_STATS_HPP
+#define QRSS_READER_PARSE_STATS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QObject macros (Q_GADGET, Q_PROPERTY)
+#ifndef QOBJECTDEFS_H
+#include <qobjectdefs.h>
+#endif // !QOBJECTDEFS_H
+
+// Include QMetaType
+#ifndef QMETATYPE_H
+#include <qmetatype.h>
+#endif // !QMETATYPE_H
+
+// Include QString
+#ifndef QSTRING_H
+#include <qstring.h>
+#endif // !QSTRING_H
+
+// ===========================================================
+// rss::ParseStats
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * ParseStats - statistics of one RSS-document parsing.
+	  *
+	  * @brief
+	  * Sent by ChannelModel::parseFinished, so expensive Feeds can be found
+	  * in release builds. Fields readable from QML (stats.parseTime).
+	  * Times in nanoseconds.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	struct ParseStats final
+	{
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// QT MACROS
+		// ===========================================================
+
+		Q_GADGET
+
+		Q_PROPERTY( QString path MEMBER mPath )
+		Q_PROPERTY( int engine MEMBER mEngine )
+		Q_PROPERTY( bool parsed MEMBER mParsed )
+		Q_PROPERTY( bool unchanged MEMBER mUnchanged )
+		Q_PROPERTY( int exceededLimit MEMBER mExceededLimit )
+		Q_PROPERTY( qint64 bytesRead MEMBER mBytesRead )
+		Q_PROPERTY( int elements MEMBER mElements )
+		Q_PROPERTY( int itemsCreated MEMBER mItemsCreated )
+		Q_PROPERTY( int itemsMerged MEMBER mItemsMerged )
+		Q_PROPERTY( int itemsRejected MEMBER mItemsRejected )
+		Q_PROPERTY( int itemsSkipped MEMBER mItemsSkipped )
+		Q_PROPERTY( qint64 allocations MEMBER mAllocations )
+		Q_PROPERTY( qint64 arenaBlocks MEMBER mArenaBlocks )
+		Q_PROPERTY( qint64 arenaReserved MEMBER mArenaReserved )
+		Q_PROPERTY( qint64 arenaUsed MEMBER mArenaUsed )
+		Q_PROPERTY( qint64 readTime MEMBER mReadTime )
+		Q_PROPERTY( qint64 parseTime MEMBER mParseTime )
+		Q_PROPERTY( qint64 mergeTime MEMBER mMergeTime )
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** File-Path. **/
+		QString mPath;
+
+		/** ChannelModel::ParserEngine. **/
+		int mEngine;
+
+		/** 'true' if document parsed whole. **/
+		bool mParsed;
+
+		/** 'true' if File bytes unchanged since last reading (same fingerprint), so not parsed. **/
+		bool mUnchanged;
+
+		/** ParseLimits::LimitType, which stopped parsing. **/
+		int mExceededLimit;
+
+		/** Number of File bytes read. **/
+		qint64 mBytesRead;
+
+		/** Number of Elements read. **/
+		int mElements;
+
+		/** Number of Items created (or indexed). **/
+		int mItemsCreated;
+
+		/** Number of Items added to ChannelModel. **/
+		int mItemsMerged;
+
+		/** Number of Items dropped: older dublicates, malformed or not closed Items. **/
+		int mItemsRejected;
+
+		/** Number of Items not built, their bytes read from the same source before. **/
+		int mItemsSkipped;
+
+		/** Number of Elements (Channels, Items & their Elements) allocated. **/
+		qint64 mAllocations;
+
+		/** Number of Arena blocks allocated (heap allocations, replacing per-Element allocations). **/
+		qint64 mArenaBlocks;
+
+		/** Number of Arena block bytes allocated. **/
+		qint64 mArenaReserved;
+
+		/** Number of Arena block bytes used by Elements. Reserved minus used is fragmentation. **/
+		qint64 mArenaUsed;
+
+		/** Time of File opening & mapping. **/
+		qint64 mReadTime;
+
+		/** Time of parsing. **/
+		qint64 mParseTime;
+
+		/** Time of adding parsed Channel to ChannelModel. **/
+		qint64 mMergeTime;
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		  * ParseStats constructor.
+		  *
+		  * @throws - no exceptions.
+		**/
+		ParseStats( ) noexcept
+			: mPath( ),
+			  mEngine( 0 ),
+			  mParsed( false ),
+			  mUnchanged( false ),
+			  mExceededLimit( 0 ),
+			  mBytesRead( 0 ),
+			  mElements( 0 ),
+			  mItemsCreated( 0 ),
+			  mItemsMerged( 0 ),
+			  mItemsRejected( 0 ),
+			  mItemsSkipped( 0 ),
+			  mAllocations( 0 ),
+			  mArenaBlocks( 0 ),
+			  mArenaReserved( 0 ),
+			  mArenaUsed( 0 ),
+			  mReadTime( 0 ),
+			  mParseTime( 0 ),
+			  mMergeTime( 0 )
+		{
+		}
+
+		// -----------------------------------------------------------
+
+	}; // rss::ParseStats
+
+	// -----------------------------------------------------------
+
+} // rss
+
+Q_DECLARE_METATYPE( rss::ParseStats )
+
+#define QRSS_READER_PARSE_STATS_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_PARSE_STATS_HPP
@@ -0,0 +1,135 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_POOL_STATS_HPP
+#define QRSS_READER_POOL_STATS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QObject macros (Q_GADGET, Q_PROPERTY)
+#ifndef QOBJECTDEFS_H
+#include <qobjectdefs.h>
+#endif // !QOBJECTDEFS_H
+
+// Include QMetaType
+#ifndef QMETATYPE_H
+#include <qmetatype.h>
+#endif // !QMETATYPE_H
+
+// ===========================================================
+// rss::PoolStats
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * PoolStats - statistics of Elements pool (rss::ElementPool).
+	  *
+	  * @brief
+	  * Returned by ChannelModel (getTextPoolStats, etc), so pools of long-running
+	  * instance can be checked in release builds. Fields readable from QML (stats.hits).
+	  * Counters are totals since start.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	struct PoolStats final
+	{
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// QT MACROS
+		// ===========================================================
+
+		Q_GADGET
+
+		Q_PROPERTY( qint64 hits MEMBER mHits )
+		Q_PROPERTY( qint64 misses MEMBER mMisses )
+		Q_PROPERTY( qint64 live MEMBER mLive )
+		Q_PROPERTY( qint64 highWater MEMBER mHighWater )
+		Q_PROPERTY( qint64 pooled MEMBER mPooled )
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Number of Elements allocated from pooled memory. **/
+		qint64 mHits;
+
+		/** Number of Elements allocated on heap, pool was empty. **/
+		qint64 mMisses;
+
+		/** Number of pooled-type Elements alive (heap, not Arena). **/
+		qint64 mLive;
+
+		/** Max number of pooled-type Elements alive at once. **/
+		qint64 mHighWater;
+
+		/** Number of free Elements, kept by shared pool (thread caches not counted). **/
+		qint64 mPooled;
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		  * PoolStats constructor.
+		  *
+		  * @throws - no exceptions.
+		**/
+		PoolStats( ) noexcept
+			: mHits( 0 ),
+			  mMisses( 0 ),
+			  mLive( 0 ),
+			  mHighWater( 0 ),
+			  mPooled( 0 )
+		{
+		}
+
+		// -----------------------------------------------------------
+
+	}; // rss::PoolStats
+
+	// -----------------------------------------------------------
+
+} // rss
+
+Q_DECLARE_METATYPE( rss::PoolStats )
+
+#define QRSS_READER_POOL_STATS_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_POOL_STATS_HPP
@@ -0,0 +1,418 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef QRSS_READER_RSS_TAGS_HPP
+#include "RSSTags.hpp"
+#endif // !QRSS_READER_RSS_TAGS_HPP
+
+// ===========================================================
+// rss::RSSTags
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// CONSTANTS
+	// ===========================================================
+
+	constexpr unsigned int RSSTags::HASH_SEED;
+	constexpr unsigned int RSSTags::HASH_PRIME;
+	constexpr unsigned int RSSTags::SLOTS_COUNT;
+
+	namespace
+	{
+
+		/** Element-Names, indexed by rss::RSSTag. **/
+		constexpr const char *const TAG_NAMES[TAG_COUNT] =
+		{
+			"",
+			"rss",
+			"channel",
+			"item",
+			"title",
+			"link",
+			"description",
+			"language",
+			"copyright",
+			"managingEditor",
+			"webMaster",
+			"pubDate",
+			"lastBuildDate",
+			"category",
+			"generator",
+			"docs",
+			"cloud",
+			"ttl",
+			"image",
+			"url",
+			"width",
+			"height",
+			"textInput",
+			"name",
+			"skipHours",
+			"skipDays",
+			"enclosure",
+			"guid",
+			"author",
+			"comments",
+			"source",
+			"feed",
+			"entry",
+			"id",
+			"updated",
+			"published",
+			"summary",
+			"content",
+			"subtitle",
+			"rdf:RDF",
+			"dc:date",
+			"content:encoded",
+			"dc:creator",
+			"media:thumbnail",
+			"media:content",
+			"media:group"
+		};
+
+		/** Known Namespace. **/
+		struct Namespace
+		{
+
+			/** Namespace-URI. **/
+			const char * mURI;
+
+			/** Prefix, used in TAG_NAMES. **/
+			const char * mPrefix;
+
+		}; /// Namespace
+
+		/** Known Namespaces. **/
+		constexpr const Namespace NAMESPACES[] =
+		{
+			{ "http://purl.org/rss/1.0/modules/content/", "content" },
+			{ "http://purl.org/dc/elements/1.1/", "dc" },
+			{ "http://search.yahoo.com/mrss/", "media" },
+			{ "http://www.w3.org/1999/02/22-rdf-syntax-ns#", "rdf" }
+		};
+
+		/** Max. length of prefixed Tag-Name. **/
+		constexpr int MAX_NAME_LENGTH = 32;
+
+		/**
+		  * Compile-time strlen.
+		  *
+		  * @param pName - string.
+		  * @return - number of characters.
+		**/
+		constexpr int nameLength( const char *const pName ) noexcept
+		{ return( *pName == '\0' ? 0 : 1 + nameLength( pName + 1 ) ); }
+
+		/**
+		  * Returns Slot of Tag.
+		  *
+		  * @param pTag - Tag-Index.
+		  * @return - Slot-Index.
+		**/
+		constexpr unsigned int tagSlot( const int pTag ) noexcept
+		{ return( RSSTags::slot( RSSTags::hash( TAG_NAMES[pTag] ) ) ); }
+
+		/**
+		  * Checks that Tag don't share Slot with any following Tag.
+		  *
+		  * @param pTag - Tag-Index.
+		  * @param pOther - Index of Tag to compare with.
+		  * @return - 'true' if Slots differ.
+		**/
+		constexpr bool isSlotUnique( const int pTag, const int pOther ) noexcept
+		{ return( pOther >= TAG_COUNT || ( tagSlot( pTag ) != tagSlot( pOther ) && isSlotUnique( pTag, pOther + 1 ) ) ); }
+
+		/**
+		  * Checks that all Tags starting from pTag have own Slots.
+		  *
+		  * @param pTag - first Tag-Index.
+		  * @return - 'true' if hash is perfect.
+		**/
+		constexpr bool isHashPerfect( const int pTag ) noexcept
+		{ return( pTag >= TAG_COUNT || ( isSlotUnique( pTag, pTag + 1 ) && isHashPerfect( pTag + 1 ) ) ); }
+
+		// TAG_UNKNOWN excluded, empty name never looked up.
+		static_assert( isHashPerfect( TAG_UNKNOWN + 1 ), "RSSTags - Tag-Names collide, change RSSTags::HASH_SEED." );
+
+		/**
+		  * TagSlots - Slot-Index to Tag table.
+		  *
+		  * @brief
+		  * Filled once, during static initialization.
+		**/
+		struct TagSlots final
+		{
+
+			/** Tags. **/
+			RSSTag mTags[RSSTags::SLOTS_COUNT];
+
+			/** Tag-Names lengths, to reject unknown names without compare. **/
+			int mLengths[TAG_COUNT];
+
+			/**
+			  * TagSlots constructor.
+			  *
+			  * @throws - no exceptions.
+			**/
+			TagSlots( ) noexcept
+			{
+
+				// Reset Slots.
+				for( unsigned int i = 0; i < RSSTags::SLOTS_COUNT; i++ )
+					mTags[i] = TAG_UNKNOWN;
+
+				// Add Tags.
+				for( int i = TAG_UNKNOWN; i < TAG_COUNT; i++ )
+				{
+
+					// Name Length.
+					mLengths[i] = nameLength( TAG_NAMES[i] );
+
+					// Slot
+					if ( i != TAG_UNKNOWN )
+						mTags[tagSlot( i )] = static_cast<RSSTag>( i );
+
+				} /// Add Tags.
+
+			}
+
+		}; // TagSlots
+
+		/** Slot-Index to Tag table. **/
+		const TagSlots TAG_SLOTS;
+
+	} // namespace
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Resolves Tag from Element-Name.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pName - Element-Name characters.
+	  * @param pLength - number of characters.
+	  * @return - Tag, or TAG_UNKNOWN.
+	  * @throws - no exceptions.
+	**/
+	RSSTag RSSTags::fromName( const QChar *const pName, const int pLength ) noexcept
+	{
+
+		// Hash characters.
+		unsigned int hash_( HASH_SEED );
+		for( int i = 0; i < pLength; i++ )
+		{
+
+			// Character code.
+			const ushort char_( pName[i].unicode( ) );
+
+			// All RSS Tag-Names are ASCII.
+			if ( char_ > 0x7F )
+				return( TAG_UNKNOWN );
+
+			// Hash
+			hash_ = ( hash_ ^ char_ ) * HASH_PRIME;
+
+		} /// Hash characters.
+
+		// Get Tag from Slot.
+		const RSSTag tag_( TAG_SLOTS.mTags[slot( hash_ )] );
+
+		// Reject unknown name, which hashed to a used Slot.
+		if ( TAG_SLOTS.mLengths[tag_] != pLength )
+			return( TAG_UNKNOWN );
+
+		// Compare Names.
+		const char *const tagName_( TAG_NAMES[tag_] );
+		for( int i = 0; i < pLength; i++ )
+		{
+			if ( pName[i].unicode( ) != static_cast<ushort>( tagName_[i] ) )
+				return( TAG_UNKNOWN );
+		}
+
+		// Return Tag
+		return( tag_ );
+
+	} /// RSSTags::fromName
+
+	/**
+	  * Resolves Tag from Element-Name.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pName - Element-Name.
+	  * @return - Tag, or TAG_UNKNOWN.
+	  * @throws - no exceptions.
+	**/
+	RSSTag RSSTags::fromName( const QString & pName ) noexcept
+	{ return( fromName( pName.constData( ), pName.size( ) ) ); }
+
+	/**
+	  * Resolves Tag from Element-Name bytes (UTF-8, Latin1).
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pName - Element-Name bytes.
+	  * @param pLength - number of bytes.
+	  * @return - Tag, or TAG_UNKNOWN.
+	  * @throws - no exceptions.
+	**/
+	RSSTag RSSTags::fromName( const char *const pName, const int pLength ) noexcept
+	{
+
+		// Hash bytes.
+		unsigned int hash_( HASH_SEED );
+		for( int i = 0; i < pLength; i++ )
+		{
+
+			// Byte
+			const unsigned char byte_( static_cast<unsigned char>( pName[i] ) );
+
+			// All RSS Tag-Names are ASCII.
+			if ( byte_ > 0x7F )
+				return( TAG_UNKNOWN );
+
+			// Hash
+			hash_ = ( hash_ ^ byte_ ) * HASH_PRIME;
+
+		} /// Hash bytes.
+
+		// Get Tag from Slot.
+		const RSSTag tag_( TAG_SLOTS.mTags[slot( hash_ )] );
+
+		// Reject unknown name, which hashed to a used Slot.
+		if ( TAG_SLOTS.mLengths[tag_] != pLength )
+			return( TAG_UNKNOWN );
+
+		// Compare Names.
+		const char *const tagName_( TAG_NAMES[tag_] );
+		for( int i = 0; i < pLength; i++ )
+		{
+			if ( pName[i] != tagName_[i] )
+				return( TAG_UNKNOWN );
+		}
+
+		// Return Tag
+		return( tag_ );
+
+	} /// RSSTags::fromName
+
+	/**
+	  * Returns Element-Name of Tag.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pTag - Tag.
+	  * @return - Element-Name, or empty string for TAG_UNKNOWN.
+	  * @throws - no exceptions.
+	**/
+	const char * RSSTags::getName( const RSSTag pTag ) noexcept
+	{ return( pTag < TAG_COUNT ? TAG_NAMES[pTag] : TAG_NAMES[TAG_UNKNOWN] ); }
+
+	/**
+	  * Resolves Tag from Namespace-URI & local Element-Name.
+	  * Lets Feeds use own prefixes for known Namespaces (content, dc, media, rdf).
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pNamespaceURI - Namespace-URI.
+	  * @param pLocalName - Element-Name without prefix.
+	  * @return - Tag, or TAG_UNKNOWN.
+	  * @throws - no exceptions.
+	**/
+	RSSTag RSSTags::fromNamespace( const QString & pNamespaceURI, const QString & pLocalName ) noexcept
+	{ return( fromNamespace( QStringRef( &pNamespaceURI ), QStringRef( &pLocalName ) ) ); }
+
+	/**
+	  * Resolves Tag from Namespace-URI & local Element-Name.
+	  * Used by pull-parser, so names not copied to QString.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pNamespaceURI - Namespace-URI.
+	  * @param pLocalName - Element-Name without prefix.
+	  * @return - Tag, or TAG_UNKNOWN.
+	  * @throws - no exceptions.
+	**/
+	RSSTag RSSTags::fromNamespace( const QStringRef & pNamespaceURI, const QStringRef & pLocalName ) noexcept
+	{
+
+		// Search Namespace.
+		for( const Namespace & namespace_ : NAMESPACES )
+		{
+
+			// Compare URI.
+			if ( pNamespaceURI != QLatin1String( namespace_.mURI ) )
+				continue;
+
+			// Prefixed Name, without allocations.
+			char name_[MAX_NAME_LENGTH];
+			int length_( 0 );
+
+			// Prefix
+			for( const char * prefix_ = namespace_.mPrefix; *prefix_ != '\0'; prefix_++ )
+				name_[length_++] = *prefix_;
+			name_[length_++] = ':';
+
+			// Cancel, if too long for any Tag.
+			if ( length_ + pLocalName.size( ) > MAX_NAME_LENGTH )
+				return( TAG_UNKNOWN );
+
+			// Local Name, ASCII only.
+			const QChar *const localName_( pLocalName.unicode( ) );
+			for( int i = 0; i < pLocalName.size( ); i++ )
+			{
+
+				// Character code.
+				const ushort char_( localName_[i].unicode( ) );
+
+				// Cancel, if not ASCII.
+				if ( char_ > 0x7F )
+					return( TAG_UNKNOWN );
+
+				// Add
+				name_[length_++] = static_cast<char>( char_ );
+
+			} /// Local Name, ASCII only.
+
+			// Resolve Tag.
+			return( fromName( name_, length_ ) );
+
+		} /// Search Namespace.
+
+		// Unknown Namespace.
+		return( TAG_UNKNOWN );
+
+	} /// RSSTags::fromNamespace
+
+	// -----------------------------------------------------------
+
+} // rss
+
+// -----------------------------------------------------------
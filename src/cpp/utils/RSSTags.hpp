@@ -0,0 +1,341 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_RSS_TAGS_HPP
+#define QRSS_READER_RSS_TAGS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QString
+#ifndef QSTRING_H
+#include <qstring.h>
+#endif // !QSTRING_H
+
+// ===========================================================
+// rss::RSSTag
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * RSSTag - interned RSS, Atom & RDF Element-Names.
+	  *
+	  * @brief
+	  * Tag-ID resolved once per XML Element, so parser don't compare strings.
+	  * Order must match names-table in RSSTags.cpp.
+	**/
+	enum RSSTag : unsigned char
+	{
+
+		/** Unknown (not RSS) Element. **/
+		TAG_UNKNOWN = 0,
+
+		/** <rss> **/
+		TAG_RSS = 1,
+
+		/** <channel> **/
+		TAG_CHANNEL = 2,
+
+		/** <item> **/
+		TAG_ITEM = 3,
+
+		/** <title> **/
+		TAG_TITLE = 4,
+
+		/** <link> **/
+		TAG_LINK = 5,
+
+		/** <description> **/
+		TAG_DESCRIPTION = 6,
+
+		/** <language> **/
+		TAG_LANGUAGE = 7,
+
+		/** <copyright> **/
+		TAG_COPYRIGHT = 8,
+
+		/** <managingEditor> **/
+		TAG_MANAGING_EDITOR = 9,
+
+		/** <webMaster> **/
+		TAG_WEB_MASTER = 10,
+
+		/** <pubDate> **/
+		TAG_PUB_DATE = 11,
+
+		/** <lastBuildDate> **/
+		TAG_LAST_BUILD_DATE = 12,
+
+		/** <category> **/
+		TAG_CATEGORY = 13,
+
+		/** <generator> **/
+		TAG_GENERATOR = 14,
+
+		/** <docs> **/
+		TAG_DOCS = 15,
+
+		/** <cloud> **/
+		TAG_CLOUD = 16,
+
+		/** <ttl> **/
+		TAG_TTL = 17,
+
+		/** <image> **/
+		TAG_IMAGE = 18,
+
+		/** <url> **/
+		TAG_URL = 19,
+
+		/** <width> **/
+		TAG_WIDTH = 20,
+
+		/** <height> **/
+		TAG_HEIGHT = 21,
+
+		/** <textInput> **/
+		TAG_TEXT_INPUT = 22,
+
+		/** <name> **/
+		TAG_NAME = 23,
+
+		/** <skipHours> **/
+		TAG_SKIP_HOURS = 24,
+
+		/** <skipDays> **/
+		TAG_SKIP_DAYS = 25,
+
+		/** <enclosure> **/
+		TAG_ENCLOSURE = 26,
+
+		/** <guid> **/
+		TAG_GUID = 27,
+
+		/** <author> **/
+		TAG_AUTHOR = 28,
+
+		/** <comments> **/
+		TAG_COMMENTS = 29,
+
+		/** <source> **/
+		TAG_SOURCE = 30,
+
+		/** Atom <feed> **/
+		TAG_FEED = 31,
+
+		/** Atom <entry> **/
+		TAG_ENTRY = 32,
+
+		/** Atom <id> **/
+		TAG_ID = 33,
+
+		/** Atom <updated> **/
+		TAG_UPDATED = 34,
+
+		/** Atom <published> **/
+		TAG_PUBLISHED = 35,
+
+		/** Atom <summary> **/
+		TAG_SUMMARY = 36,
+
+		/** Atom <content> **/
+		TAG_CONTENT = 37,
+
+		/** Atom <subtitle> **/
+		TAG_SUBTITLE = 38,
+
+		/** RSS 1.0 <rdf:RDF> root. Prefix "rdf" used by all RSS 1.0 Feeds. **/
+		TAG_RDF = 39,
+
+		/** Dublin Core <dc:date>, RSS 1.0 Item date. **/
+		TAG_DC_DATE = 40,
+
+		/** <content:encoded> **/
+		TAG_CONTENT_ENCODED = 41,
+
+		/** <dc:creator> **/
+		TAG_DC_CREATOR = 42,
+
+		/** <media:thumbnail url="" /> **/
+		TAG_MEDIA_THUMBNAIL = 43,
+
+		/** <media:content url="" /> **/
+		TAG_MEDIA_CONTENT = 44,
+
+		/** <media:group> **/
+		TAG_MEDIA_GROUP = 45,
+
+		/** Number of Tags. **/
+		TAG_COUNT
+
+	}; // rss::RSSTag
+
+	// ===========================================================
+	// rss::RSSTags
+	// ===========================================================
+
+	/**
+	  * RSSTags - resolves Element-Names to rss::RSSTag.
+	  *
+	  * @brief
+	  * Perfect hash: FNV-1a with a seed, picked so all known names
+	  * fall into different slots (checked by static_assert in RSSTags.cpp).
+	  * Lookup costs one hash & one string compare, to reject unknown names.
+	  * Prefixed names (dc:date) compared as written, so <atom:link> never
+	  * resolves to RSS <link>.
+	  * If static_assert fails after adding new Tag, change HASH_SEED.
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	class RSSTags final
+	{
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTANTS
+		// ===========================================================
+
+		/** Hash Seed. **/
+		static constexpr unsigned int HASH_SEED = 2166136290u;
+
+		/** FNV-1a Prime. **/
+		static constexpr unsigned int HASH_PRIME = 16777619u;
+
+		/** Number of Slots in Hash-Table. Power of 2. **/
+		static constexpr unsigned int SLOTS_COUNT = 256u;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Compile-time hash of Tag-Name.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pName - Tag-Name.
+		  * @param pHash - Hash of previous characters.
+		  * @return - hash.
+		  * @throws - no exceptions.
+		**/
+		static constexpr unsigned int hash( const char *const pName, const unsigned int pHash = HASH_SEED ) noexcept
+		{ return( *pName == '\0' ? pHash : hash( pName + 1, ( pHash ^ static_cast<unsigned char>( *pName ) ) * HASH_PRIME ) ); }
+
+		/**
+		  * Returns Slot-Index for hash.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pHash - hash.
+		  * @return - Slot-Index.
+		  * @throws - no exceptions.
+		**/
+		static constexpr unsigned int slot( const unsigned int pHash ) noexcept
+		{ return( ( pHash ^ ( pHash >> 16 ) ) & ( SLOTS_COUNT - 1u ) ); }
+
+		/**
+		  * Resolves Tag from Element-Name.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pName - Element-Name characters.
+		  * @param pLength - number of characters.
+		  * @return - Tag, or TAG_UNKNOWN.
+		  * @throws - no exceptions.
+		**/
+		static RSSTag fromName( const QChar *const pName, const int pLength ) noexcept;
+
+		/**
+		  * Resolves Tag from Element-Name.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pName - Element-Name.
+		  * @return - Tag, or TAG_UNKNOWN.
+		  * @throws - no exceptions.
+		**/
+		static RSSTag fromName( const QString & pName ) noexcept;
+
+		/**
+		  * Resolves Tag from Element-Name bytes (UTF-8, Latin1).
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pName - Element-Name bytes.
+		  * @param pLength - number of bytes.
+		  * @return - Tag, or TAG_UNKNOWN.
+		  * @throws - no exceptions.
+		**/
+		static RSSTag fromName( const char *const pName, const int pLength ) noexcept;
+
+		/**
+		  * Returns Element-Name of Tag.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pTag - Tag.
+		  * @return - Element-Name, or empty string for TAG_UNKNOWN.
+		  * @throws - no exceptions.
+		**/
+		static const char * getName( const RSSTag pTag ) noexcept;
+
+		/**
+		  * Resolves Tag from Namespace-URI & local Element-Name.
+		  * Lets Feeds use own prefixes for known Namespaces (content, dc, media, rdf).
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pNamespaceURI - Namespace-URI.
+		  * @param pLocalName - Element-Name without prefix.
+		  * @return - Tag, or TAG_UNKNOWN.
+		  * @throws - no exceptions.
+		**/
+		static RSSTag fromNamespace( const QString & pNamespaceURI, const QString & pLocalName ) noexcept;
+
+		/**
+		  * Resolves Tag from Namespace-URI & local Element-Name.
+		  * Used by pull-parser, so names not copied to QString.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pNamespaceURI - Namespace-URI.
+		  * @param pLocalName - Element-Name without prefix.
+		  * @return - Tag, or TAG_UNKNOWN.
+		  * @throws - no exceptions.
+		**/
+		static RSSTag fromNamespace( const QStringRef & pNamespaceURI, const QStringRef & pLocalName ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // rss::RSSTags
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_RSS_TAGS_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_RSS_TAGS_HPP
@@ -34,6 +34,11 @@
 #include "../rss/ChannelModel.hpp"
 #endif // !Q_RSS_READER_CHANNEL_MODEL_HPP
 
+// Include rss::ElementArena
+#ifndef QRSS_READER_ELEMENT_ARENA_HPP
+#include "ElementArena.hpp"
+#endif // !QRSS_READER_ELEMENT_ARENA_HPP
+
 #if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
 
 // Include QDebug
@@ -52,6 +57,283 @@ namespace rss
 
 	// -----------------------------------------------------------
 
+	// ===========================================================
+	// TransitionTable
+	// ===========================================================
+
+	/**
+	  * (RSSPosition x RSSTag) to RSSPosition table.
+	  *
+	  * @brief
+	  * Replaces per-Element chain of Element-Name compares.
+	  * Pairs not listed lead to RSS_SKIP.
+	**/
+	struct SAXRSSHandler::TransitionTable final
+	{
+
+		/** Positions. **/
+		unsigned char mPositions[RSS_POSITIONS_COUNT][TAG_COUNT];
+
+		/** Positions, which Text collected & used when Element ends. **/
+		bool mText[RSS_POSITIONS_COUNT];
+
+		/** Positions, which Attributes are read. **/
+		bool mAttributes[RSS_POSITIONS_COUNT];
+
+		/**
+		  * TransitionTable constructor.
+		  *
+		  * @throws - no exceptions.
+		**/
+		TransitionTable( ) noexcept
+		{
+
+			/** Transition. **/
+			struct Transition
+			{
+
+				/** Parent-Element Position. **/
+				RSSPosition mFrom;
+
+				/** Element Tag. **/
+				RSSTag mTag;
+
+				/** Element Position. **/
+				RSSPosition mTo;
+
+			}; /// Transition
+
+			/** Transitions. **/
+			static const Transition TRANSITIONS[] =
+			{
+				// Document
+				{ RSS_DOCUMENT, TAG_RSS, RSS_ROOT },
+				{ RSS_DOCUMENT, TAG_CHANNEL, RSS_CHANNEL_OPEN },
+				{ RSS_ROOT, TAG_CHANNEL, RSS_CHANNEL_OPEN },
+
+				// <channel>
+				{ RSS_CHANNEL_OPEN, TAG_TITLE, RSS_CHANNEL_TITLE },
+				{ RSS_CHANNEL_OPEN, TAG_LINK, RSS_CHANNEL_LINK },
+				{ RSS_CHANNEL_OPEN, TAG_DESCRIPTION, RSS_CHANNEL_DESCRIPTION },
+				{ RSS_CHANNEL_OPEN, TAG_LANGUAGE, RSS_CHANNEL_LANGUAGE },
+				{ RSS_CHANNEL_OPEN, TAG_COPYRIGHT, RSS_CHANNEL_COPYRIGHT },
+				{ RSS_CHANNEL_OPEN, TAG_MANAGING_EDITOR, RSS_CHANNEL_MANAGING_EDITOR },
+				{ RSS_CHANNEL_OPEN, TAG_WEB_MASTER, RSS_CHANNEL_WEB_MASTER },
+				{ RSS_CHANNEL_OPEN, TAG_PUB_DATE, RSS_CHANNEL_PUB_DATE },
+				{ RSS_CHANNEL_OPEN, TAG_LAST_BUILD_DATE, RSS_CHANNEL_LAST_BUILD_DATE },
+				{ RSS_CHANNEL_OPEN, TAG_CATEGORY, RSS_CHANNEL_CATEGORY },
+				{ RSS_CHANNEL_OPEN, TAG_GENERATOR, RSS_GENERATOR },
+				{ RSS_CHANNEL_OPEN, TAG_DOCS, RSS_DOCS },
+				{ RSS_CHANNEL_OPEN, TAG_CLOUD, RSS_CLOUD },
+				{ RSS_CHANNEL_OPEN, TAG_TTL, RSS_CHANNEL_TTL },
+				{ RSS_CHANNEL_OPEN, TAG_IMAGE, RSS_CHANNEL_IMAGE },
+				{ RSS_CHANNEL_OPEN, TAG_TEXT_INPUT, RSS_CHANNEL_TEXT_INPUT },
+				{ RSS_CHANNEL_OPEN, TAG_SKIP_HOURS, RSS_CHANNEL_SKIP_HOURS },
+				{ RSS_CHANNEL_OPEN, TAG_SKIP_DAYS, RSS_CHANNEL_SKIP_DAYS },
+				{ RSS_CHANNEL_OPEN, TAG_ITEM, RSS_ITEM_OPEN },
+
+				// <image>
+				{ RSS_CHANNEL_IMAGE, TAG_URL, RSS_CHANNEL_IMAGE_URL },
+				{ RSS_CHANNEL_IMAGE, TAG_TITLE, RSS_CHANNEL_IMAGE_TITLE },
+				{ RSS_CHANNEL_IMAGE, TAG_LINK, RSS_CHANNEL_IMAGE_LINK },
+				{ RSS_CHANNEL_IMAGE, TAG_DESCRIPTION, RSS_CHANNEL_IMAGE_DESCRIPTION },
+				{ RSS_CHANNEL_IMAGE, TAG_WIDTH, RSS_CHANNEL_IMAGE_WIDTH },
+				{ RSS_CHANNEL_IMAGE, TAG_HEIGHT, RSS_CHANNEL_IMAGE_HEIGHT },
+
+				// <textInput>
+				{ RSS_CHANNEL_TEXT_INPUT, TAG_TITLE, RSS_CHANNEL_TEXT_INPUT_TITLE },
+				{ RSS_CHANNEL_TEXT_INPUT, TAG_DESCRIPTION, RSS_CHANNEL_TEXT_INPUT_DESCRIPTION },
+				{ RSS_CHANNEL_TEXT_INPUT, TAG_NAME, RSS_CHANNEL_TEXT_INPUT_NAME },
+				{ RSS_CHANNEL_TEXT_INPUT, TAG_LINK, RSS_CHANNEL_TEXT_INPUT_LINK },
+
+				// <item>
+				{ RSS_ITEM_OPEN, TAG_TITLE, RSS_ITEM_TITLE },
+				{ RSS_ITEM_OPEN, TAG_LINK, RSS_ITEM_LINK },
+				{ RSS_ITEM_OPEN, TAG_DESCRIPTION, RSS_ITEM_DESCRIPTION },
+				{ RSS_ITEM_OPEN, TAG_COMMENTS, RSS_ITEM_COMMENTS },
+				{ RSS_ITEM_OPEN, TAG_CATEGORY, RSS_ITEM_CATEGORY },
+				{ RSS_ITEM_OPEN, TAG_ENCLOSURE, RSS_ITEM_ENCLOSURE },
+				{ RSS_ITEM_OPEN, TAG_GUID, RSS_ITEM_GUID },
+				{ RSS_ITEM_OPEN, TAG_PUB_DATE, RSS_ITEM_PUB_DATE },
+				{ RSS_ITEM_OPEN, TAG_SOURCE, RSS_ITEM_SOURCE },
+
+				// Atom <feed>
+				{ RSS_DOCUMENT, TAG_FEED, ATOM_FEED },
+				{ ATOM_FEED, TAG_TITLE, RSS_CHANNEL_TITLE },
+				{ ATOM_FEED, TAG_SUBTITLE, RSS_CHANNEL_DESCRIPTION },
+				{ ATOM_FEED, TAG_UPDATED, RSS_CHANNEL_LAST_BUILD_DATE },
+				{ ATOM_FEED, TAG_ID, ATOM_FEED_ID },
+				{ ATOM_FEED, TAG_LINK, ATOM_FEED_LINK },
+				{ ATOM_FEED, TAG_ENTRY, ATOM_ENTRY },
+
+				// Atom <entry>
+				{ ATOM_ENTRY, TAG_TITLE, RSS_ITEM_TITLE },
+				{ ATOM_ENTRY, TAG_ID, RSS_ITEM_GUID },
+				{ ATOM_ENTRY, TAG_PUBLISHED, RSS_ITEM_PUB_DATE },
+				{ ATOM_ENTRY, TAG_UPDATED, ATOM_ENTRY_UPDATED },
+				{ ATOM_ENTRY, TAG_LINK, ATOM_ENTRY_LINK },
+				{ ATOM_ENTRY, TAG_SUMMARY, ATOM_ENTRY_CONTENT },
+				{ ATOM_ENTRY, TAG_CONTENT, ATOM_ENTRY_CONTENT },
+				{ ATOM_ENTRY, TAG_CATEGORY, ATOM_ENTRY_CATEGORY },
+
+				// RSS 1.0 <rdf:RDF>
+				{ RSS_DOCUMENT, TAG_RDF, RDF_ROOT },
+				{ RDF_ROOT, TAG_CHANNEL, RSS_CHANNEL_OPEN },
+				{ RDF_ROOT, TAG_IMAGE, RSS_CHANNEL_IMAGE },
+				{ RDF_ROOT, TAG_ITEM, RDF_ITEM },
+
+				// RSS 1.0 <item>
+				{ RDF_ITEM, TAG_TITLE, RSS_ITEM_TITLE },
+				{ RDF_ITEM, TAG_LINK, RSS_ITEM_LINK },
+				{ RDF_ITEM, TAG_DESCRIPTION, RSS_ITEM_DESCRIPTION },
+				{ RDF_ITEM, TAG_DC_DATE, ITEM_EXTENSION_TEXT },
+
+				// Extensions
+				{ RSS_ITEM_OPEN, TAG_CONTENT_ENCODED, ITEM_EXTENSION_TEXT },
+				{ RSS_ITEM_OPEN, TAG_DC_CREATOR, ITEM_EXTENSION_TEXT },
+				{ RSS_ITEM_OPEN, TAG_DC_DATE, ITEM_EXTENSION_TEXT },
+				{ RSS_ITEM_OPEN, TAG_MEDIA_THUMBNAIL, ITEM_EXTENSION_URL },
+				{ RSS_ITEM_OPEN, TAG_MEDIA_CONTENT, ITEM_EXTENSION_URL },
+				{ RSS_ITEM_OPEN, TAG_MEDIA_GROUP, ITEM_MEDIA_GROUP },
+				{ RDF_ITEM, TAG_CONTENT_ENCODED, ITEM_EXTENSION_TEXT },
+				{ RDF_ITEM, TAG_DC_CREATOR, ITEM_EXTENSION_TEXT },
+				{ ATOM_ENTRY, TAG_MEDIA_THUMBNAIL, ITEM_EXTENSION_URL },
+				{ ATOM_ENTRY, TAG_MEDIA_CONTENT, ITEM_EXTENSION_URL },
+				{ ATOM_ENTRY, TAG_MEDIA_GROUP, ITEM_MEDIA_GROUP },
+				{ ITEM_MEDIA_GROUP, TAG_MEDIA_THUMBNAIL, ITEM_EXTENSION_URL },
+				{ ITEM_MEDIA_GROUP, TAG_MEDIA_CONTENT, ITEM_EXTENSION_URL },
+				{ ITEM_EXTENSION_URL, TAG_MEDIA_THUMBNAIL, ITEM_EXTENSION_URL }
+			};
+
+			// Unknown by default.
+			for( int i = 0; i < RSS_POSITIONS_COUNT; i++ )
+			{
+				for( int j = 0; j < TAG_COUNT; j++ )
+					mPositions[i][j] = RSS_SKIP;
+			}
+
+			// Add Transitions.
+			for( const Transition & transition_ : TRANSITIONS )
+				mPositions[transition_.mFrom][transition_.mTag] = static_cast<unsigned char>( transition_.mTo );
+
+			// Any Element inside Atom <content type="xhtml"> (<div>, <p>) keeps collecting <content> Text.
+			for( int j = 0; j < TAG_COUNT; j++ )
+			{
+				mPositions[ATOM_ENTRY_CONTENT][j] = ATOM_ENTRY_CONTENT_MARKUP;
+				mPositions[ATOM_ENTRY_CONTENT_MARKUP][j] = ATOM_ENTRY_CONTENT_MARKUP;
+			}
+
+			/** Positions with Text. **/
+			static const RSSPosition TEXT_POSITIONS[] =
+			{
+				RSS_CHANNEL_TITLE,
+				RSS_CHANNEL_LINK,
+				RSS_CHANNEL_DESCRIPTION,
+				RSS_CHANNEL_LAST_BUILD_DATE,
+				RSS_CHANNEL_TTL,
+				RSS_CHANNEL_SKIP_HOURS,
+				RSS_CHANNEL_SKIP_DAYS,
+				RSS_CHANNEL_IMAGE_URL,
+				RSS_CHANNEL_IMAGE_TITLE,
+				RSS_CHANNEL_IMAGE_LINK,
+				RSS_CHANNEL_IMAGE_DESCRIPTION,
+				RSS_CHANNEL_IMAGE_WIDTH,
+				RSS_CHANNEL_IMAGE_HEIGHT,
+				RSS_CHANNEL_TEXT_INPUT_TITLE,
+				RSS_CHANNEL_TEXT_INPUT_DESCRIPTION,
+				RSS_CHANNEL_TEXT_INPUT_NAME,
+				RSS_CHANNEL_TEXT_INPUT_LINK,
+				RSS_ITEM_TITLE,
+				RSS_ITEM_LINK,
+				RSS_ITEM_DESCRIPTION,
+				RSS_ITEM_COMMENTS,
+				RSS_ITEM_CATEGORY,
+				RSS_ITEM_GUID,
+				RSS_ITEM_PUB_DATE,
+				RSS_ITEM_SOURCE,
+				ATOM_FEED_ID,
+				ATOM_ENTRY_UPDATED,
+				ATOM_ENTRY_CONTENT,
+				ATOM_ENTRY_CONTENT_MARKUP,
+				ITEM_EXTENSION_TEXT
+			};
+
+			// No Text by default.
+			for( int i = 0; i < RSS_POSITIONS_COUNT; i++ )
+				mText[i] = false;
+
+			// Add Text Positions.
+			for( const RSSPosition position_ : TEXT_POSITIONS )
+				mText[position_] = true;
+
+			/** Positions with Attributes. **/
+			static const RSSPosition ATTRIBUTE_POSITIONS[] =
+			{
+				RSS_CLOUD,
+				RSS_CHANNEL_CATEGORY,
+				RSS_ITEM_CATEGORY,
+				RSS_ITEM_ENCLOSURE,
+				RSS_ITEM_SOURCE,
+				ATOM_FEED_LINK,
+				ATOM_ENTRY_LINK,
+				ATOM_ENTRY_CATEGORY,
+				RDF_ITEM,
+				ITEM_EXTENSION_URL
+			};
+
+			// No Attributes by default.
+			for( int i = 0; i < RSS_POSITIONS_COUNT; i++ )
+				mAttributes[i] = false;
+
+			// Add Attribute Positions.
+			for( const RSSPosition position_ : ATTRIBUTE_POSITIONS )
+				mAttributes[position_] = true;
+
+		}
+
+		/**
+		  * Returns Position of Element.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pFrom - Parent-Element Position.
+		  * @param pTag - Element Tag.
+		  * @return - Element Position.
+		  * @throws - no exceptions.
+		**/
+		RSSPosition get( const RSSPosition pFrom, const RSSTag pTag ) const noexcept
+		{ return( static_cast<RSSPosition>( mPositions[pFrom][pTag] ) ); }
+
+		/**
+		  * Returns 'true' if Text of Element at Position is used.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pPosition - Element Position.
+		  * @return - 'true' if Text collected, 'false' if ignored.
+		  * @throws - no exceptions.
+		**/
+		bool collectsText( const RSSPosition pPosition ) const noexcept
+		{ return( mText[pPosition] ); }
+
+		/**
+		  * Returns 'true' if Attributes of Element at Position are used.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pPosition - Element Position.
+		  * @return - 'true' if Attributes read, 'false' if ignored.
+		  * @throws - no exceptions.
+		**/
+		bool usesAttributes( const RSSPosition pPosition ) const noexcept
+		{ return( mAttributes[pPosition] ); }
+
+	}; /// SAXRSSHandler::TransitionTable
+
+	// ===========================================================
+	// FIELDS
+	// ===========================================================
+
+	/** Position Transitions. **/
+	const SAXRSSHandler::TransitionTable SAXRSSHandler::mTransitions;
+
 	// ===========================================================
 	// CONSTRUCTOR
 	// ===========================================================
@@ -60,22 +342,50 @@ namespace rss
 	  * SAXRSSHandler constructor.
 	  *
 	  * @param pChannel - Channel-class to update directly.
-	  * @param pModel - ChannelModel.
+	  * @param pModel - ChannelModel, or null to fill own (staging) Channel only.
 	  * @throws - no exceptions.
 	**/
 	SAXRSSHandler::SAXRSSHandler( rss::Channel *const pChannel, rss::ChannelModel *const pModel ) noexcept
 		: mChannel( pChannel ),
-		  mCurrState( SAXRSSHandler::RSSPosition::RSS_CHANNEL_OPEN ),
-		  mPrevState( SAXRSSHandler::RSSPosition::RSS_CHANNEL_OPEN ),
+		  mCurrState( SAXRSSHandler::RSSPosition::RSS_DOCUMENT ),
+		  mStates( ),
+		  mText( ),
+		  mRawText( ),
+		  mRawCharset( nullptr ),
 		  mValues( ),
 		  mItem( ),
-		  mChannelModel( pModel )
+		  mChannelModel( pModel ),
+		  mChannelAdded( false ),
+		  mItemsCount( 0 ),
+		  mAtomFeedID( ),
+		  mAtomUpdated( ),
+		  mExtensionTag( TAG_UNKNOWN ),
+		  mIndexPath( ),
+		  mIndexSize( 0 ),
+		  mIndexModified( 0 ),
+		  mLoadItem( false ),
+		  mHashItems( false ),
+		  mKnownItems( ),
+		  mItemHashes( ),
+		  mLimits( ),
+		  mParseTimer( ),
+		  mExceededLimit( ParseLimits::NO_LIMIT ),
+		  mRecovery( false ),
+		  mDiagnostics( ),
+		  mStats( ),
+		  mPrevArena( nullptr ),
+		  mUseArena( true )
 	{
 
-#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
-		// Check ChannelModel instance.
-		assert( pModel != nullptr && "SAXRSSHandler::constructor - ChannelModel is null !" );
-#endif // DEBUG
+		// Allocate Elements from Channel Arena.
+		mPrevArena = ElementArena::bind( nullptr );
+		bindArena( );
+
+		// Reserve States. RSS nesting is shallow.
+		mStates.reserve( 16 );
+
+		// Reserve Text-buffer once, reused for all Elements.
+		mText.reserve( TEXT_BUFFER_CAPACITY );
 
 	}
 
@@ -95,6 +405,13 @@ namespace rss
 		//if ( mChannel != nullptr )
 			//delete mChannel;
 
+		// Delete Item, not closed (</item>) when parsing stopped.
+		if ( mItem != nullptr )
+			delete mItem;
+
+		// Restore Arena.
+		ElementArena::bind( mPrevArena );
+
 	}
 
 	// ===========================================================
@@ -102,7 +419,8 @@ namespace rss
 	// ===========================================================
 
 	/**
-	  * Returns RSS Channel-class instance.
+	  * Returns RSS Channel-class instance & releases ownership.
+	  * Item, not closed when parsing stopped, deleted.
 	  *
 	  * @threadsafe - not thread-safe.
 	  * @return - Channel, or null if RSS document is invalid.
@@ -110,15 +428,558 @@ namespace rss
 	**/
 	rss::Channel * SAXRSSHandler::getChannel( ) noexcept
 	{
+		// Delete not closed Item, before Channel (it's Arena) deleted by caller.
+		if ( mItem != nullptr && !mLoadItem )
+		{
+			delete mItem;
+			mItem = nullptr;
+		}
+
 		// Copy-pointer-value.
 		rss::Channel *const result_( mChannel );
 
-		// Reset Channel-pointer.
-		mChannel = nullptr;
+		// Reset Channel-pointer.
+		mChannel = nullptr;
+		bindArena( );
+
+		// Return RSS Channel-class Instance.
+		return( result_ );
+	}
+
+	/**
+	  * Takes Item, loaded after #beginItem.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - Item, or null if not loaded.
+	  * @throws - no exceptions.
+	**/
+	rss::Item * SAXRSSHandler::takeItem( ) noexcept
+	{
+
+		// Item is kept only when it's closed (</item>).
+		if ( !mLoadItem || mCurrState == RSS_ITEM_OPEN || mCurrState == ATOM_ENTRY || mCurrState == RDF_ITEM )
+			return( nullptr );
+
+		// Copy-pointer-value.
+		rss::Item *const result_( mItem );
+
+		// Reset Item-pointer.
+		mItem = nullptr;
+
+		// Return Item.
+		return( result_ );
+
+	} /// SAXRSSHandler::takeItem
+
+	/**
+	  * Returns number of Items added to Channel so far.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - number of closed (</item>) Items.
+	  * @throws - no exceptions.
+	**/
+	int SAXRSSHandler::countItems( ) const noexcept
+	{ return( mItemsCount ); }
+
+	/**
+	  * Returns 'true' when Channel added to ChannelModel,
+	  * or merged with added Channel (<link> parsed).
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::isChannelAdded( ) const noexcept
+	{ return( mChannelAdded ); }
+
+	/**
+	  * Returns parsing limits.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - ParseLimits.
+	  * @throws - no exceptions.
+	**/
+	const ParseLimits & SAXRSSHandler::getLimits( ) const noexcept
+	{ return( mLimits ); }
+
+	/**
+	  * Returns limit, which stopped parsing.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - LimitType, NO_LIMIT if document parsed whole (or failed).
+	  * @throws - no exceptions.
+	**/
+	ParseLimits::LimitType SAXRSSHandler::getExceededLimit( ) const noexcept
+	{ return( mExceededLimit ); }
+
+	/**
+	  * Returns 'true' if recovery mode enabled.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::recovers( ) const noexcept
+	{ return( mRecovery ); }
+
+	/**
+	  * Returns 'true' if Elements allocated from Channel Arena.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::usesArena( ) const noexcept
+	{ return( mUseArena ); }
+
+	/**
+	  * Returns parsing problems.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - ParseDiagnostics.
+	  * @throws - no exceptions.
+	**/
+	const ParseDiagnostics & SAXRSSHandler::getDiagnostics( ) const noexcept
+	{ return( mDiagnostics ); }
+
+	/**
+	  * Returns parsing statistics.
+	  * Elements & Items counted by Handler, bytes & times set by reader.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - ParseStats.
+	  * @throws - no exceptions.
+	**/
+	ParseStats & SAXRSSHandler::getStats( ) noexcept
+	{ return( mStats ); }
+
+	/**
+	  * Returns hashes of Items bytes, which Items skipped.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - hashes.
+	  * @throws - no exceptions.
+	**/
+	const QSet<quint64> & SAXRSSHandler::getKnownItems( ) const noexcept
+	{ return( mKnownItems ); }
+
+	/**
+	  * Returns hashes of Items bytes, read by reader.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - hashes.
+	  * @throws - no exceptions.
+	**/
+	QSet<quint64> & SAXRSSHandler::getItemHashes( ) noexcept
+	{ return( mItemHashes ); }
+
+	// ===========================================================
+	// SETTERS
+	// ===========================================================
+
+	/**
+	  * Enables Items indexing: only Item bytes location recorded,
+	  * Items loaded later with #beginItem.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pPath - File-Path, or empty QString to load Items.
+	  * @param pSize - File size, checked when Item loaded.
+	  * @param pModified - File modification time (ms since epoch), checked when Item loaded.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::setItemsIndex( const QString & pPath, const qint64 pSize, const qint64 pModified ) noexcept
+	{
+
+		// Set
+		mIndexPath = pPath;
+		mIndexSize = pSize;
+		mIndexModified = pModified;
+
+	} /// SAXRSSHandler::setItemsIndex
+
+	/**
+	  * Enables Items hashing: reader hashes bytes of every Item,
+	  * Items with known hash (read from the same source before) not built.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pHashes - hashes of Items bytes, added before.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::setKnownItems( const QSet<quint64> & pHashes ) noexcept
+	{
+
+		// Set
+		mKnownItems = pHashes;
+		mHashItems = true;
+
+	} /// SAXRSSHandler::setKnownItems
+
+	/**
+	  * Sets parsing limits & starts parsing time.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pLimits - ParseLimits.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::setLimits( const ParseLimits & pLimits ) noexcept
+	{
+
+		// Set Limits.
+		mLimits = pLimits;
+
+		// Start time.
+		mParseTimer.start( );
+
+	} /// SAXRSSHandler::setLimits
+
+	/**
+	  * Enables recovery mode: malformed Item dropped,
+	  * reader continues from the next Item.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pRecovery - 'true' to recover.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::setRecovery( const bool pRecovery ) noexcept
+	{ mRecovery = pRecovery; }
+
+	/**
+	  * Enables Channel Arena. Disabled, when File read again:
+	  * rejected (not newer) Items would keep Arena memory until Channel deleted,
+	  * so Elements allocated on heap & Elements pools.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pUseArena - 'true' to allocate Elements from Channel Arena (default).
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::setUseArena( const bool pUseArena ) noexcept
+	{
+
+		// Set
+		mUseArena = pUseArena;
+
+		// Rebind
+		bindArena( );
+
+	} /// SAXRSSHandler::setUseArena
+
+	/**
+	  * Sets parsing problems, found by staging Handler.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pDiagnostics - ParseDiagnostics.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::setDiagnostics( const ParseDiagnostics & pDiagnostics ) noexcept
+	{ mDiagnostics = pDiagnostics; }
+
+	/**
+	  * Prepares Handler to load single Item from it's bytes.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pParentTag - Item Parent-Element Tag (<channel>, <feed>, <rdf:RDF>).
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::beginItem( const RSSTag pParentTag ) noexcept
+	{
+
+		// Reset States.
+		mStates.resize( 0 );
+		mStates.push_back( RSS_DOCUMENT );
+
+		// Continue from Item Parent-Element, as if Document read up to Item.
+		switch( pParentTag )
+		{
+		case TAG_FEED:
+			mCurrState = ATOM_FEED;
+			break;
+		case TAG_RDF:
+			mCurrState = RDF_ROOT;
+			break;
+		default:
+			mCurrState = RSS_CHANNEL_OPEN;
+			break;
+		}
+
+		// Keep Item, allocated on heap.
+		mLoadItem = true;
+		bindArena( );
+
+	} /// SAXRSSHandler::beginItem
+
+	/**
+	  * Binds Arena of Channel to thread, so Elements allocated from it.
+	  * Single loaded Item, or Channel without Arena (#setUseArena) allocated on heap.
+	  *
+	  * (?) Handler, kept between event-loop turns (incremental parsing),
+	  * bound before each chunk. Caller restores previous Arena after chunk.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::bindArena( ) noexcept
+	{ ElementArena::bind( mChannel != nullptr && mUseArena && !mLoadItem ? &mChannel->getArena( ) : nullptr ); }
+
+	// ===========================================================
+	// EVENTS
+	// ===========================================================
+
+	/**
+	  * Returns 'true' if Text of current Element is used.
+	  * Lets reader skip decoding of ignored Text.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if Text collected, 'false' if ignored.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::collectsText( ) const noexcept
+	{ return( mTransitions.collectsText( mCurrState ) ); }
+
+	/**
+	  * Returns 'true' if raw Text of current Element can be kept,
+	  * & decoded when it's displayed (Item Description).
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pLength - number of raw bytes.
+	  * @return - 'true' to pass raw Text with #onRawText, 'false' to decode it.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::defersText( const qint64 pLength ) const noexcept
+	{
+
+		// Item Description, or first Atom <summary>, <content>.
+		if ( mCurrState != RSS_ITEM_DESCRIPTION && ( mCurrState != ATOM_ENTRY_CONTENT || mItem->getElement( rss::ElementType::DESCRITION ) != nullptr ) )
+			return( false );
+
+		// Text is never longer than bytes, so longer Text decoded & checked by characters.
+		return( mLimits.mMaxTextLength <= 0 || pLength <= mLimits.mMaxTextLength );
+
+	} /// SAXRSSHandler::defersText
+
+	/**
+	  * Returns 'true' if Attributes of Element are used.
+	  * Lets reader skip Attributes decoding.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pTag - Element Tag, child of current Element.
+	  * @return - 'true' if Attributes read, 'false' if ignored.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::usesAttributes( const RSSTag pTag ) const noexcept
+	{ return( mTransitions.usesAttributes( mTransitions.get( mCurrState, pTag ) ) ); }
+
+	/**
+	  * Returns 'true' if Element is Item & Items indexed.
+	  * Reader then skips Item & calls #onItemSkipped.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pTag - Element Tag, child of current Element.
+	  * @return - 'true' to skip Element.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::skipsItem( const RSSTag pTag ) const noexcept
+	{
+
+		// Cancel, if Items loaded.
+		if ( mIndexPath.isEmpty( ) )
+			return( false );
+
+		// Return TRUE, if Item.
+		return( opensItem( pTag ) );
+
+	} /// SAXRSSHandler::skipsItem
+
+	/**
+	  * Returns 'true' if Element is Item (<item>, <entry>).
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pTag - Element Tag, child of current Element.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::opensItem( const RSSTag pTag ) const noexcept
+	{
+
+		// Element State.
+		const RSSPosition position_( mTransitions.get( mCurrState, pTag ) );
+
+		// Return TRUE, if Item.
+		return( position_ == RSS_ITEM_OPEN || position_ == ATOM_ENTRY || position_ == RDF_ITEM );
+
+	} /// SAXRSSHandler::opensItem
+
+	/**
+	  * Records skipped Item.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pOffset - Offset of Item in File.
+	  * @param pLength - number of bytes.
+	  * @param pCharset - table of Document single-byte charset, null for UTF-8.
+	  * @return - 'true' to continue, 'false' to stop.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::onItemSkipped( const qint64 pOffset, const int pLength, const ushort *const pCharset ) noexcept
+	{
+
+		// RSS 1.0 Item outside <channel>, Channel created if Feed has none.
+		if ( mChannel == nullptr )
+		{
+			mChannel = new rss::Channel( );
+			bindArena( );
+		}
+
+		// Item Parent-Element.
+		const RSSTag parentTag_( mCurrState == ATOM_FEED ? TAG_FEED : ( mCurrState == RDF_ROOT ? TAG_RDF : TAG_CHANNEL ) );
+
+		// Add Item record.
+		mChannel->addItemRecord( rss::Channel::ItemRecord{ mIndexPath, mIndexSize, mIndexModified, pOffset, pLength, parentTag_, pCharset } );
+		mItemsCount++;
+		mStats.mElements++;
+		mStats.mItemsCreated++;
+
+		// Stop, if Items limit reached.
+		if ( mLimits.mMaxItems > 0 && mItemsCount >= mLimits.mMaxItems )
+			return( onLimitReached( ParseLimits::ITEMS_LIMIT ) );
+
+		// Return TRUE
+		return( true );
+
+	} /// SAXRSSHandler::onItemSkipped
+
+	/**
+	  * Returns 'true' if reader passes hash of every Item bytes (#onItemHashed).
+	  * Not used, when Items indexed.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::hashesItems( ) const noexcept
+	{ return( mHashItems && mIndexPath.isEmpty( ) ); }
+
+	/**
+	  * Records hash of Item bytes.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pHash - hash of Item bytes, start-tag to end-tag.
+	  * @return - 'true' if Item known & must be skipped, 'false' to read it.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::onItemHashed( const quint64 pHash ) noexcept
+	{
+
+		// Record hash.
+		mItemHashes.insert( pHash );
+
+		// Cancel, if new Item.
+		if ( !mKnownItems.contains( pHash ) )
+			return( false );
+
+		// Count skipped Item.
+		mStats.mItemsSkipped++;
+
+		// Return TRUE
+		return( true );
+
+	} /// SAXRSSHandler::onItemHashed
+
+	/**
+	  * Records reached limit. Items accepted so far are kept.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pLimit - LimitType.
+	  * @return - 'false', to stop parsing.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::onLimitReached( const ParseLimits::LimitType pLimit ) noexcept
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "SAXRSSHandler::onLimitReached - limit=" << pLimit << ", items=" << mItemsCount;
+#endif // DEBUG
+
+		// Keep first reached limit.
+		if ( mExceededLimit == ParseLimits::NO_LIMIT )
+			mExceededLimit = pLimit;
+
+		// Return FALSE
+		return( false );
+
+	} /// SAXRSSHandler::onLimitReached
+
+	/**
+	  * Drops malformed Item, continues from Items Parent-Element.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pDepth - number of open Elements, including Items Parent-Element.
+	  * @param pOffset - Offset of dropped bytes.
+	  * @param pLength - number of dropped bytes.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::onRecovered( const int pDepth, const qint64 pOffset, const qint64 pLength ) noexcept
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "SAXRSSHandler::onRecovered - offset=" << pOffset << ", length=" << pLength;
+#endif // DEBUG
+
+		// Restore Parent-Elements States.
+		while( mStates.size( ) > pDepth )
+		{
+			mCurrState = mStates.last( );
+			mStates.pop_back( );
+		}
+
+		// Delete Item, not closed (</item>).
+		delete mItem;
+		mItem = nullptr;
+
+		// Reset values of dropped Elements.
+		mText.resize( 0 );
+		mRawText = QByteArray( );
+		mValues.clear( );
+		mAtomUpdated.clear( );
+		mExtensionTag = TAG_UNKNOWN;
+
+		// Record Region.
+		mDiagnostics.mRecovered.push_back( ParseDiagnostics::Region{ pOffset, pLength } );
+
+	} /// SAXRSSHandler::onRecovered
+
+	/**
+	  * Takes Channel, filled by staging Handler.
+	  * Channel added to ChannelModel, or merged with own Channel.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pChannel - Channel. Ownership transfered.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::adoptChannel( rss::Channel *const pChannel ) noexcept
+	{
+
+		// Cancel, if no Channel.
+		if ( pChannel == nullptr )
+			return;
+
+		// Add to ChannelModel.
+		if ( mChannelModel != nullptr )
+		{
+			mChannelModel->addStagingChannel( pChannel );
+			return;
+		}
+
+		// Take Channel.
+		if ( mChannel == nullptr )
+		{
+			mChannel = pChannel;
+			bindArena( );
+			return;
+		}
+
+		// Merge with own Channel.
+		rss::Channel::merge( pChannel, mChannel );
 
-		// Return RSS Channel-class Instance.
-		return( result_ );
-	}
+		// Delete merged Channel.
+		delete pChannel;
+
+	} /// SAXRSSHandler::adoptChannel
 
 	/**
 	  * Search Attribute.
@@ -169,6 +1030,69 @@ namespace rss
 
 	} /// SAXRSSHandler::getValue
 
+	/**
+	  * Records error, which stopped parsing. First error kept.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pException - error details.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::setError( const QXmlParseException & pException ) noexcept
+	{
+
+		// Cancel, if error already recorded.
+		if ( !mDiagnostics.mError.isEmpty( ) )
+			return;
+
+		// Record error.
+		mDiagnostics.mError = pException.message( );
+		mDiagnostics.mErrorLine = pException.lineNumber( );
+		mDiagnostics.mErrorColumn = pException.columnNumber( );
+
+	} /// SAXRSSHandler::setError
+
+	/**
+	  * Returns href of Atom <link>, if it's alternate (page) link.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pAttrs - Attributes.
+	  * @return - href, or empty QString for "self", "enclosure", etc.
+	  * @throws - no exceptions.
+	**/
+	QString SAXRSSHandler::getAtomLink( const QXmlAttributes & pAttrs ) noexcept
+	{
+
+		// Relation, "alternate" by default.
+		const QString rel_( getAttribute( "rel", pAttrs ) );
+
+		// Return href of alternate link.
+		return( rel_.isEmpty( ) || rel_ == "alternate" ? getAttribute( "href", pAttrs ) : QString( ) );
+
+	} /// SAXRSSHandler::getAtomLink
+
+	/**
+	  * Sets Channel Link & adds Channel to ChannelModel.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pUrl - Link.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::setChannelLink( const QString & pUrl ) noexcept
+	{
+
+		// Add Link Element.
+		mChannel->setElement( new rss::Link( pUrl, mChannel, rss::ElementType::LINK ) );
+
+		// Check dublicates. Staging Handler (without Model) keeps own Channel.
+		if ( mChannelModel != nullptr )
+		{
+			mChannel = mChannelModel->addChannel( mChannel, true );
+			mChannelAdded = true;
+			bindArena( );
+		}
+
+	} /// SAXRSSHandler::setChannelLink
+
 	// ===========================================================
 	// OVERRIDE: QXmlDefaultHandler
 	// ===========================================================
@@ -209,7 +1133,11 @@ namespace rss
 		qDebug( ) << "SAXRSSHandler::error=" << exception.message( );
 #endif // DEBUG
 
-		return( false );
+		// Record error.
+		setError( exception );
+
+		// Continue in recovery mode, error is not fatal.
+		return( mRecovery );
 	}
 
 	/**
@@ -227,6 +1155,9 @@ namespace rss
 		qDebug( ) << "SAXRSSHandler::fatalError=" << exception.message( );
 #endif // DEBUG
 
+		// Record error.
+		setError( exception );
+
 		return( false );
 	}
 
@@ -251,518 +1182,282 @@ namespace rss
 	} /// SAXRSSHandler::startDocument
 
 	/**
-	  * Called when element has been read.
+	  * Handles Element start.
 	  *
 	  * @threadsafe - not thread-safe.
-	  * @param namespaceURI - Namespace.
-	  * @param locaName - Element-Name with Namespace-prefix.
-	  * @param qName - Element-Name (<rss>).
+	  * @param pTag - Element Tag.
 	  * @param pAttrs - Attributes.
-	  * @return - 'true' to OK, 'false' if error.
+	  * @return - 'true' to continue, 'false' to stop.
 	  * @throws - no exceptions.
 	**/
-	bool SAXRSSHandler::startElement( const QString& namespaceURI, const QString & localName, const QString & qName, const QXmlAttributes & pAttrs )
+	bool SAXRSSHandler::onStartTag( const RSSTag pTag, const QXmlAttributes & pAttrs ) noexcept
 	{
 
-		Q_UNUSED( namespaceURI )
-		Q_UNUSED( localName )
-
-#if defined( QT_DEBUG ) // DEBUG
-		// Debug
-		qDebug( ) << "SAXRSSHandler::startElement: " << qName;
-#endif // DEBUG
-
-		// <channel>
-		if ( qName == "channel" )
-		{
+		// Stop, if Elements nested too deep.
+		if ( mLimits.mMaxDepth > 0 && mStates.size( ) >= mLimits.mMaxDepth )
+			return( onLimitReached( ParseLimits::DEPTH_LIMIT ) );
 
-			// Create new Channel.
-			if ( mChannel == nullptr )
-				mChannel = new rss::Channel( );
+		// Stop, if parsing time is over.
+		if ( mLimits.mTimeBudget > 0 && mParseTimer.hasExpired( mLimits.mTimeBudget ) )
+			return( onLimitReached( ParseLimits::TIME_LIMIT ) );
 
-			// Set State.
-			mCurrState = RSSPosition::RSS_CHANNEL_OPEN;
+		// Count Element.
+		mStats.mElements++;
 
-			// Stop
-			return( true );
+		// Save Parent-Element State.
+		mStates.push_back( mCurrState );
 
-		} /// <channel>
+		// Set State.
+		mCurrState = mTransitions.get( mCurrState, pTag );
 
-		// <width>
-		if ( qName == "width" )
+		// Handle Element start.
+		switch( mCurrState )
 		{
 
-			// State
-			if ( mCurrState == RSS_CHANNEL_IMAGE )
-				mCurrState = RSS_CHANNEL_IMAGE_WIDTH;
-
-			// Stop
-			return( true );
-
-		} /// <width>
-
-		// <height>
-		if ( qName == "height" )
+		// <channel>, <feed>
+		case RSS_CHANNEL_OPEN:
+		case ATOM_FEED:
 		{
 
-			// State
-			if ( mCurrState == RSS_CHANNEL_IMAGE )
-				mCurrState = RSS_CHANNEL_IMAGE_HEIGHT;
+			// Create new Channel.
+			if ( mChannel == nullptr )
+			{
+				mChannel = new rss::Channel( );
+				bindArena( );
+			}
 
 			// Stop
-			return( true );
+			break;
 
-		} /// <height>
+		} /// <channel>, <feed>
 
-		// <item>
-		if ( qName == "item" )
+		// <item>, <entry>
+		case RSS_ITEM_OPEN:
+		case ATOM_ENTRY:
+		case RDF_ITEM:
 		{
 
-			// Set State
-			mCurrState = RSSPosition::RSS_ITEM_OPEN;
+			// RSS 1.0 Item outside <channel>, Channel created if Feed has none.
+			if ( mChannel == nullptr )
+			{
+				mChannel = new rss::Channel( );
+				bindArena( );
+			}
 
 			// Create Item.
 			mItem = new rss::Item( mChannel );
+			mStats.mItemsCreated++;
 
-			// Stop
-			return( true );
-
-		} /// <item>
-
-		// <source>
-		if ( qName == "source" )
-		{
-
-			// Item
-			if ( mCurrState == RSS_ITEM_OPEN )
+			// RSS 1.0 Item identity, used as GUID.
+			if ( mCurrState == RDF_ITEM )
 			{
 
-				// Get domain.
-				mValues["url"] = getAttribute( "url", pAttrs );
-
-				// Set State.
-				mCurrState = RSS_ITEM_SOURCE;
-
-				// Stop
-				return( true );
-
-			} /// Item
-
-		} /// <source>
-
-		// <lastBuildDate>
-		if ( qName == "lastBuildDate" )
-		{
-
-			// State
-			if ( mCurrState == RSS_CHANNEL_OPEN )
-				mCurrState = RSS_CHANNEL_LAST_BUILD_DATE;
-
-		} /// <lastBuildDate>
-
-		// <guid>
-		if ( qName == "guid" )
-		{
-
-			// Item
-			if ( mCurrState == RSS_ITEM_OPEN )
-				mCurrState = RSS_ITEM_GUID;
-
-			// Stop
-			return( true );
-
-		} /// <guid>
-
-		// <pubDate>
-		if ( qName == "pubDate" )
-		{
-
-			// Item
-			if ( mCurrState == RSS_ITEM_OPEN )
-				mCurrState = RSS_ITEM_PUB_DATE;
+				// rdf:about
+				const QString about_( getAttribute( "about", pAttrs ) );
 
-			// Stop
-			return( true );
-
-		} /// <pubDate>
-
-		// <comments>
-		if ( qName == "comments" )
-		{
+				// Add GUID Element.
+				if ( !about_.isEmpty( ) )
+					mItem->setElement( new rss::GUID( about_, mItem, rss::ElementType::GUID ) );
 
-			// Item
-			if ( mCurrState == RSS_ITEM_OPEN )
-				mCurrState = RSS_ITEM_COMMENTS;
+			} /// RSS 1.0 Item identity, used as GUID.
 
 			// Stop
-			return( true );
+			break;
 
-		} /// <comments>
+		} /// <item>, <entry>
 
-		// <enclosure>
-		if ( qName == "enclosure" && mCurrState == RSS_ITEM_OPEN )
+		// Atom Feed <link />
+		case ATOM_FEED_LINK:
 		{
 
-			// Url
-			const QString url_( getAttribute( "url", pAttrs ) );
-
-			// Length
-			const QString length_( getAttribute( "length", pAttrs ) );
-
-			// Type
-			const QString type_( getAttribute( "type", pAttrs ) );
+			// Alternate link.
+			const QString href_( getAtomLink( pAttrs ) );
 
-			// Add Enclosure Element to a Item.
-			if ( !url_.isEmpty( ) )
-				mItem->setElement( new rss::Enclosure( url_, mItem, length_, type_ ) );
+			// First alternate link used as Channel Link.
+			if ( !href_.isEmpty( ) && mChannel->getElement( rss::ElementType::LINK ) == nullptr )
+				setChannelLink( href_ );
 
 			// Stop
-			return( true );
+			break;
 
-		} /// <enclosure>
+		} /// Atom Feed <link />
 
-		// <category>
-		if ( qName == "category" )
+		// Atom Entry <link />
+		case ATOM_ENTRY_LINK:
 		{
 
-			// Get domain.
-			mValues["domain"] = getAttribute( "domain", pAttrs );
-
-			// Set State.
-			if ( mCurrState == RSS_CHANNEL_OPEN )
-				mCurrState = RSS_CHANNEL_CATEGORY;
-			else if ( mCurrState == RSS_ITEM_OPEN )
-				mCurrState = RSS_ITEM_CATEGORY;
-
-			// Stop
-			return( true );
-
-		} /// <category>
-
-		// <name>
-		if ( qName == "name" )
-		{
+			// Alternate link.
+			const QString href_( getAtomLink( pAttrs ) );
 
-			// Channel TextInput
-			if ( mCurrState == RSS_CHANNEL_TEXT_INPUT )
-				mCurrState = RSS_CHANNEL_TEXT_INPUT_NAME;
+			// First alternate link used as Item Link.
+			if ( !href_.isEmpty( ) && mItem->getElement( rss::ElementType::LINK ) == nullptr )
+				mItem->setElement( new rss::Link( href_, mItem, rss::ElementType::LINK ) );
 
 			// Stop
-			return( true );
+			break;
 
-		} /// <name>
+		} /// Atom Entry <link />
 
-		// <image>
-		if ( qName == "image" )
+		// Atom Entry <category />
+		case ATOM_ENTRY_CATEGORY:
 		{
 
-			// State
-			if ( mCurrState == RSS_CHANNEL_OPEN )
-				mCurrState = RSS_CHANNEL_IMAGE;
-
-			// Stop
-			return( true );
-
-		} /// <image>
-
-		// <title>
-		if ( qName == "title" )
-		{
+			// Term
+			const QString term_( getAttribute( "term", pAttrs ) );
 
-			// Channel
-			if ( mCurrState == RSSPosition::RSS_CHANNEL_OPEN )
-				mCurrState = RSSPosition::RSS_CHANNEL_TITLE; // Set State.
-			else if ( mCurrState == RSSPosition::RSS_ITEM_OPEN ) // Item
-				mCurrState = RSSPosition::RSS_ITEM_TITLE; // Set State.
-			else if ( mCurrState == RSSPosition::RSS_CHANNEL_TEXT_INPUT )
-				mCurrState = RSSPosition::RSS_CHANNEL_TEXT_INPUT_TITLE;
+			// First Category used, as for RSS Item.
+			if ( !term_.isEmpty( ) && mItem->getElement( rss::ElementType::CATEGORY ) == nullptr )
+				mItem->setElement( new rss::Category( getAttribute( "scheme", pAttrs ), term_, mItem, rss::ElementType::CATEGORY ) );
 
 			// Stop
-			return( true );
+			break;
 
-		} /// Title
+		} /// Atom Entry <category />
 
-		// <cloud>
-		if ( qName == "cloud" )
+		// <content:encoded>, <dc:creator>, <dc:date>
+		case ITEM_EXTENSION_TEXT:
 		{
 
-			// Channel
-			if ( mCurrState == RSSPosition::RSS_CHANNEL_OPEN )
-			{
-
-				// domain
-				const QString domain_( getAttribute( "domain", pAttrs ) );
-
-				// Cancel, if domain not set.
-				if ( domain_.isEmpty( ) )
-					return( true );
-
-				// port
-				const QString attrValue_( getAttribute( "port", pAttrs ) );
-
-				// port
-				const int port_( attrValue_.isEmpty( ) ? 80 : attrValue_.toInt( ) );
-
-				// path
-				const QString path_( getAttribute( "path", pAttrs ) );
-
-				// registerProcedure
-				const QString registerProcedure_( getAttribute( "registerProcedure", pAttrs ) );
-
-				// protocol
-				const QString protocol_( getAttribute( "protocol", pAttrs ) );
-
-				// Create Cloud-Element class instance.
-				rss::Cloud *const cloud_( new rss::Cloud( domain_, mChannel, port_, path_, registerProcedure_, protocol_ ) );
-
-				// Add Cloud-Element to a Channel.
-				mChannel->setElement( cloud_ );
-
-			} /// Channel
+			// Remember Tag, Text stored when Element ends.
+			mExtensionTag = pTag;
 
 			// Stop
-			return( true );
+			break;
 
-		} /// <cloud>
+		} /// <content:encoded>, <dc:creator>, <dc:date>
 
-		// <ttl>
-		if ( qName == "ttl" )
+		// <media:thumbnail url="" />, <media:content url="" />
+		case ITEM_EXTENSION_URL:
 		{
 
-			// Set State.
-			mCurrState = RSSPosition::RSS_CHANNEL_TTL;
-
-		} /// <ttl>
-
-		// <description>
-		if ( qName == "description" )
-		{
+			// Url
+			const QString url_( getAttribute( "url", pAttrs ) );
 
-			// Channel
-			if ( mCurrState == RSSPosition::RSS_CHANNEL_OPEN )
-				mCurrState = RSSPosition::RSS_CHANNEL_DESCRIPTION;
-			else if ( mCurrState == RSSPosition::RSS_ITEM_OPEN ) // Item
-				mCurrState = RSSPosition::RSS_ITEM_DESCRIPTION;
-			else if ( mCurrState == RSSPosition::RSS_CHANNEL_TEXT_INPUT )
-				mCurrState = RSSPosition::RSS_CHANNEL_TEXT_INPUT_DESCRIPTION;
-			else if ( mCurrState == RSSPosition::RSS_CHANNEL_IMAGE )
-				mCurrState = RSSPosition::RSS_CHANNEL_IMAGE_DESCRIPTION;
+			// Store Url, first one kept.
+			if ( !url_.isEmpty( ) )
+				mItem->setExtension( pTag, url_ );
 
 			// Stop
-			return( true );
+			break;
 
-		} /// <description>
+		} /// <media:thumbnail url="" />, <media:content url="" />
 
-		// <textInput>
-		if ( qName == "textInput" )
+		// <source>
+		case RSS_ITEM_SOURCE:
 		{
 
-			// Set State
-			if ( mCurrState == RSSPosition::RSS_CHANNEL_OPEN )
-				mCurrState = RSSPosition::RSS_CHANNEL_TEXT_INPUT;
+			// Get url.
+			mValues["url"] = getAttribute( "url", pAttrs );
 
 			// Stop
-			return( true );
+			break;
 
-		} /// <textInput>
+		} /// <source>
 
-		// <skipHours>
-		if ( qName == "skipHours" )
+		// <category>
+		case RSS_CHANNEL_CATEGORY:
+		case RSS_ITEM_CATEGORY:
 		{
 
-			// Set State.
-			if ( mCurrState == RSS_CHANNEL_OPEN )
-				mCurrState = RSS_CHANNEL_SKIP_HOURS;
+			// Get domain.
+			mValues["domain"] = getAttribute( "domain", pAttrs );
 
 			// Stop
-			return( true );
+			break;
 
-		} /// <skipHours>
+		} /// <category>
 
-		// <link>
-		if ( qName == "link" )
+		// <enclosure>
+		case RSS_ITEM_ENCLOSURE:
 		{
 
-			// Channel
-			if ( mCurrState == RSSPosition::RSS_CHANNEL_OPEN )
-				mCurrState = RSSPosition::RSS_CHANNEL_LINK;
-			else if ( mCurrState == RSSPosition::RSS_ITEM_OPEN ) // Item
-				mCurrState = RSSPosition::RSS_ITEM_LINK;
-			else if ( mCurrState == RSSPosition::RSS_CHANNEL_IMAGE )
-				mCurrState = RSSPosition::RSS_CHANNEL_IMAGE_LINK;
-
-			// Stop
-			return( true );
+			// Url
+			const QString url_( getAttribute( "url", pAttrs ) );
 
-		} /// <link>
+			// Length
+			const QString length_( getAttribute( "length", pAttrs ) );
 
-		// <skipDays>
-		if ( qName == "skipDays" )
-		{
+			// Type
+			const QString type_( getAttribute( "type", pAttrs ) );
 
-			// Set State.
-			if ( mCurrState == RSS_CHANNEL_OPEN )
-				mCurrState = RSS_CHANNEL_SKIP_DAYS;
+			// Add Enclosure Element to a Item.
+			if ( !url_.isEmpty( ) )
+				mItem->setElement( new rss::Enclosure( url_, mItem, length_, type_ ) );
 
 			// Stop
-			return( true );
-
-		} /// <skipDays>
-
-		// <url>
-		if ( qName == "url" )
-		{
-
-			// State
-			if ( mCurrState == RSS_CHANNEL_IMAGE )
-				mCurrState = RSS_CHANNEL_IMAGE_URL;
-
-		} /// <url>
-
-		// Return TRUE
-		return( true );
-
-	} /// SAXRSSHandler::startElement
-
-	/**
-	  * Called when end of Element reached (</rss>).
-	  *
-	  * @threadsafe - not thread-safe.
-	  * @param namespaceURI - Namespace.
-	  * @param locaName - Element-Name with Namespace-prefix.
-	  * @param qName - Element-Name (<rss>).
-	  * @return - 'true' to OK, 'false' if error.
-	  * @throws - no exceptions.
-	**/
-	bool SAXRSSHandler::endElement( const QString& namespaceURI, const QString& localName, const QString& qName )
-	{
-
-		Q_UNUSED( namespaceURI )
-		Q_UNUSED( localName )
-		Q_UNUSED( qName )
-
-#if defined( QT_DEBUG ) // DEBUG
-		// Debug
-		qDebug( ) << "SAXRSSHandler::endElement: " << qName;
-#endif // DEBUG
-
-		// <textInput>
-		if ( qName == "textInput" )
-		{
-
-			// Channel
-			if ( mCurrState == RSSPosition::RSS_CHANNEL_TEXT_INPUT )
-			{
-
-				// <title>
-				const QString title_( getValue( "title" ) );
-
-				// <description>
-				const QString description_( getValue( "description" ) );
-
-				// <name>
-				const QString name_( getValue( "name" ) );
-
-				// <link>
-				const QString link_( getValue( "link" ) );
-
-				// Create TextInput Element instance.
-				rss::TextInput *const textInput_( new rss::TextInput( mChannel, title_, description_, name_, link_ ) );
-
-				// Add TextInput to Channel.
-				mChannel->setElement( textInput_ );
-
-				// Clear temp. Values.
-				mValues.clear( );
-
-				// Set State.
-				mCurrState = RSS_CHANNEL_OPEN;
-
-			} /// Channel
+			break;
 
-		} /// <textInput>
+		} /// <enclosure>
 
-		// <image>
-		if ( qName == "image" )
+		// <cloud>
+		case RSS_CLOUD:
 		{
 
-			// Channel
-			if ( mCurrState == RSSPosition::RSS_CHANNEL_IMAGE )
-			{
-
-				// Url
-				const QUrl url_( getValue( "url" ) );
+			// domain
+			const QString domain_( getAttribute( "domain", pAttrs ) );
 
-				// Link
-				const QUrl link_( getValue( "link" ) );
+			// Cancel, if domain not set.
+			if ( domain_.isEmpty( ) )
+				break;
 
-				// Title-value.
-				const QString title_( getValue( "title" ) );
+			// port
+			const QString attrValue_( getAttribute( "port", pAttrs ) );
 
-				// Description
-				const QString description_( getValue( "description" ) );
+			// port
+			const int port_( attrValue_.isEmpty( ) ? 80 : attrValue_.toInt( ) );
 
-				// Width
-				QString value_( getValue( "width" ) );
-				const int width_( value_.isEmpty( ) ? 88 : value_.toInt( ) );
+			// path
+			const QString path_( getAttribute( "path", pAttrs ) );
 
-				// Height
-				value_ = getValue( "height" );
-				const int height_( value_.isEmpty( ) ? 31 : value_.toInt( ) );
+			// registerProcedure
+			const QString registerProcedure_( getAttribute( "registerProcedure", pAttrs ) );
 
-				// Create Image Element class instance.
-				rss::Image *const image_( new rss::Image( mChannel, &url_, link_.isEmpty( ) ? nullptr : &link_, title_.isEmpty( ) ? nullptr : &title_, description_.isEmpty( ) ? nullptr : &description_, width_, height_ ) );
+			// protocol
+			const QString protocol_( getAttribute( "protocol", pAttrs ) );
 
-				// Attach Image to a Channel.
-				mChannel->setElement( image_ );
-
-				// Clear values.
-				mValues.clear( );
-
-				// Set State.
-				mCurrState = RSS_CHANNEL_OPEN;
-
-			} /// Channel
-
-		} /// <image>
-
-		// </item>
-		if ( qName == "item" && mItem != nullptr )
-		{
+			// Create Cloud-Element class instance.
+			rss::Cloud *const cloud_( new rss::Cloud( domain_, mChannel, port_, path_, registerProcedure_, protocol_ ) );
 
-			// Add Item to a Channel.
-			mChannel->addItem( mItem );
+			// Add Cloud-Element to a Channel.
+			mChannel->setElement( cloud_ );
 
-			// Reset
-			mItem = nullptr;
+			// Stop
+			break;
 
-			// State
-			mCurrState = RSS_CHANNEL_OPEN;
+		} /// <cloud>
 
-		} /// </item>
+		// Default
+		default:
+			break;
+
+		} /// Handle Element start.
 
 		// Return TRUE
 		return( true );
 
-	} /// SAXRSSHandler::endElement
+	} /// SAXRSSHandler::onStartTag
 
 	/**
-	  * Called when Text collected from Element
-	  * (<link>https://some_site.ko.kr/news/q93ihfrq3h0.html</link>)
+	  * Handles Element end.
 	  *
 	  * @threadsafe - not thread-safe.
-	  * @param pText - Characters.
+	  * @return - 'true' to continue, 'false' to stop.
 	  * @throws - no exceptions.
 	**/
-	bool SAXRSSHandler::characters( const QString& pText )
+	bool SAXRSSHandler::onEndTag( ) noexcept
 	{
 
-#if defined( QT_DEBUG ) // DEBUG
-		// Debug
-		qDebug( ) << "SAXRSSHandler::characters: " << pText;
-#endif // DEBUG
+		// Element collects Text. Text inside Atom <content type="xhtml"> kept until </content>.
+		const bool hasText_( mTransitions.collectsText( mCurrState ) && mCurrState != ATOM_ENTRY_CONTENT_MARKUP );
+
+		// Element Text. Exact-size copy, so buffer keeps its capacity.
+		const QString text_( hasText_ ? QString( mText.constData( ), mText.size( ) ) : QString( ) );
 
-		// Handle RSS-Document Parsing State (Position).
+		// Reset Text-buffer.
+		if ( hasText_ )
+			mText.resize( 0 );
+
+		// Handle Element end.
 		switch( mCurrState )
 		{
 
@@ -771,10 +1466,7 @@ namespace rss
 		{
 
 			// Add Element to a Channel.
-			mChannel->setElement( new rss::SkipHours( pText, mChannel, rss::ElementType::SKIP_HOURS ) );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_OPEN;
+			mChannel->setElement( new rss::SkipHours( text_, mChannel, rss::ElementType::SKIP_HOURS ) );
 
 			// Stop
 			break;
@@ -786,10 +1478,7 @@ namespace rss
 		{
 
 			// Add Element to a Channel.
-			mChannel->setElement( new rss::SkipDays( pText, mChannel, rss::ElementType::SKIP_DAYS ) );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_OPEN;
+			mChannel->setElement( new rss::SkipDays( text_, mChannel, rss::ElementType::SKIP_DAYS ) );
 
 			// Stop
 			break;
@@ -804,11 +1493,8 @@ namespace rss
 			rss::LastBuildDate *const buildDate_element( static_cast<rss::LastBuildDate*>( mChannel->getElement( rss::ElementType::LAST_BUILD_DATE ) ) );
 
 			// Compare Build-Dates.
-			if ( buildDate_element != nullptr && buildDate_element->mStringDate != pText )
-				mChannel->setElement( new rss::LastBuildDate( pText, mChannel, rss::ElementType::LAST_BUILD_DATE ) );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_OPEN;
+			if ( buildDate_element == nullptr || buildDate_element->mStringDate != text_ )
+				mChannel->setElement( new rss::LastBuildDate( text_, mChannel, rss::ElementType::LAST_BUILD_DATE ) );
 
 			// Stop
 			break;
@@ -820,10 +1506,7 @@ namespace rss
 		{
 
 			// Add Title Element to a Channel.
-			mChannel->setElement( new rss::Title( pText, mChannel, rss::ElementType::TITLE ) );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_OPEN;
+			mChannel->setElement( new rss::Title( text_, mChannel, rss::ElementType::TITLE ) );
 
 			// Stop
 			break;
@@ -835,10 +1518,7 @@ namespace rss
 		{
 
 			// Add Title Element to a Item.
-			mItem->setElement( new rss::Title( pText, mItem, rss::ElementType::TITLE ) );
-
-			// Set State.
-			mCurrState = RSS_ITEM_OPEN;
+			mItem->setElement( new rss::Title( text_, mItem, rss::ElementType::TITLE ) );
 
 			// Stop
 			break;
@@ -850,10 +1530,7 @@ namespace rss
 		{
 
 			// Add Element to a Item.
-			mItem->setElement( new rss::Link( pText, mItem, rss::ElementType::LINK ) );
-
-			// Set State.
-			mCurrState = RSS_ITEM_OPEN;
+			mItem->setElement( new rss::Link( text_, mItem, rss::ElementType::LINK ) );
 
 			// Stop
 			break;
@@ -865,10 +1542,7 @@ namespace rss
 		{
 
 			// Add Element to a Item.
-			mItem->setElement( new rss::Comments( pText, mItem, rss::ElementType::COMMENTS ) );
-
-			// Set State.
-			mCurrState = RSS_ITEM_OPEN;
+			mItem->setElement( new rss::Comments( text_, mItem, rss::ElementType::COMMENTS ) );
 
 			// Stop
 			break;
@@ -883,13 +1557,11 @@ namespace rss
 			const QString domain_( getValue( "domain" ) );
 
 			// Create Category Element intsance.
-			rss::Category *const category( new rss::Category( domain_, pText, mItem, rss::ElementType::CATEGORY ) );
+			rss::Category *const category( new rss::Category( domain_, text_, mItem, rss::ElementType::CATEGORY ) );
 
 			// Attach Category Element to a Item.
 			mItem->setElement( category );
 
-			// Set State
-			mCurrState = RSS_ITEM_OPEN;
 
 			// Clear Values.
 			mValues.clear( );
@@ -904,10 +1576,7 @@ namespace rss
 		{
 
 			// Add Element.
-			mItem->setElement( new rss::PubDate( pText, mItem, rss::ElementType::PUB_DATE ) );
-
-			// Set State
-			mCurrState = RSS_ITEM_OPEN;
+			mItem->setElement( new rss::PubDate( text_, mItem, rss::ElementType::PUB_DATE ) );
 
 			// Stop
 			break;
@@ -919,10 +1588,8 @@ namespace rss
 		{
 
 			// Add Element.
-			mItem->setElement( new rss::Source( getValue( "url" ), pText, mItem, rss::ElementType::SOURCE ) );
+			mItem->setElement( new rss::Source( getValue( "url" ), text_, mItem, rss::ElementType::SOURCE ) );
 
-			// Set State
-			mCurrState = RSS_ITEM_OPEN;
 
 			// Clear Values.
 			mValues.clear( );
@@ -937,10 +1604,7 @@ namespace rss
 		{
 
 			// Add Element.
-			mItem->setElement( new rss::GUID( pText, mItem, rss::ElementType::GUID ) );
-
-			// Set State
-			mCurrState = RSS_ITEM_OPEN;
+			mItem->setElement( new rss::GUID( text_, mItem, rss::ElementType::GUID ) );
 
 			// Stop.
 			break;
@@ -952,10 +1616,7 @@ namespace rss
 		{
 
 			// Add Description Element to a Channel.
-			mChannel->setElement( new rss::Description( pText, mChannel, rss::ElementType::DESCRITION ) );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_OPEN;
+			mChannel->setElement( new rss::Description( text_, mChannel, rss::ElementType::DESCRITION ) );
 
 			// Stop
 			break;
@@ -966,11 +1627,14 @@ namespace rss
 		case RSS_ITEM_DESCRIPTION:
 		{
 
-			// Add Description Element to a Item.
-			mItem->setElement( new rss::Description( pText, mItem, rss::ElementType::DESCRITION ) );
+			// Add Description Element to a Item. Raw Text decoded when displayed.
+			if ( mRawText.isNull( ) )
+				mItem->setElement( new rss::Description( text_, mItem, rss::ElementType::DESCRITION ) );
+			else
+				mItem->setElement( new rss::Description( mRawText, mRawCharset, mItem, rss::ElementType::DESCRITION ) );
 
-			// Set State.
-			mCurrState = RSS_ITEM_OPEN;
+			// Reset raw Text.
+			mRawText = QByteArray( );
 
 			// Stop
 			break;
@@ -982,14 +1646,11 @@ namespace rss
 		{
 
 			// Get Integer-value.
-			const int ttl_( pText.toInt( ) );
+			const int ttl_( text_.toInt( ) );
 
 			// Add TTL Element
 			mChannel->setElement( new rss::TTL( ttl_, mChannel, rss::ElementType::TTL ) );
 
-			// Set State.
-			mCurrState = RSS_CHANNEL_OPEN;
-
 			// Stop
 			break;
 
@@ -1000,25 +1661,31 @@ namespace rss
 		{
 
 			// Cache value.
-			mValues.insert( "link", pText );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_IMAGE;
+			mValues.insert( "link", text_ );
 
 			// Stop
 			break;
 
 		} /// Channel Image Link
 
+		// Channel Image Title
+		case RSS_CHANNEL_IMAGE_TITLE:
+		{
+
+			// Cache value.
+			mValues.insert( "title", text_ );
+
+			// Stop
+			break;
+
+		} /// Channel Image Title
+
 		// Channel Image Description
 		case RSS_CHANNEL_IMAGE_DESCRIPTION:
 		{
 
 			// Cache value.
-			mValues.insert( "description", pText );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_IMAGE;
+			mValues.insert( "description", text_ );
 
 			// Stop
 			break;
@@ -1030,10 +1697,7 @@ namespace rss
 		{
 
 			// Cache value.
-			mValues["url"] = pText;
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_IMAGE;
+			mValues["url"] = text_;
 
 			// Stop
 			break;
@@ -1045,10 +1709,7 @@ namespace rss
 		{
 
 			// Cache value.
-			mValues.insert( "width", pText );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_IMAGE;
+			mValues.insert( "width", text_ );
 
 			// Stop
 			break;
@@ -1060,10 +1721,7 @@ namespace rss
 		{
 
 			// Cache value.
-			mValues.insert( "height", pText );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_IMAGE;
+			mValues.insert( "height", text_ );
 
 			// Stop
 			break;
@@ -1075,10 +1733,7 @@ namespace rss
 		{
 
 			// Cache value.
-			mValues.insert( "title", pText );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_TEXT_INPUT;
+			mValues.insert( "title", text_ );
 
 			// Stop
 			break;
@@ -1089,29 +1744,90 @@ namespace rss
 		case RSS_CHANNEL_LINK:
 		{
 
-			// Add Link Element.
-			mChannel->setElement( new rss::Link( pText, mChannel, rss::ElementType::LINK ) );
+			// Add Link Element & Channel.
+			setChannelLink( text_ );
 
-			// Set State
-			mCurrState = RSS_CHANNEL_OPEN;
+			// Stop
+			break;
 
-			// Check dublicates.
-			mChannel = mChannelModel->addChannel( mChannel, true );
+		}
+
+		// Atom Feed <id>
+		case ATOM_FEED_ID:
+		{
+
+			// Cache value, used if Feed has no <link>.
+			mAtomFeedID = text_;
 
 			// Stop
 			break;
 
-		}
+		} /// Atom Feed <id>
+
+		// Atom Entry <updated>
+		case ATOM_ENTRY_UPDATED:
+		{
+
+			// Cache value, used if Entry has no <published>.
+			mAtomUpdated = text_;
+
+			// Stop
+			break;
+
+		} /// Atom Entry <updated>
+
+		// Atom Entry <summary>, <content>
+		case ATOM_ENTRY_CONTENT:
+		{
+
+			// First one used as Description. Raw Text decoded when displayed.
+			if ( !mRawText.isNull( ) )
+				mItem->setElement( new rss::Description( mRawText, mRawCharset, mItem, rss::ElementType::DESCRITION ) );
+			else if ( mItem->getElement( rss::ElementType::DESCRITION ) == nullptr )
+				mItem->setElement( new rss::Description( text_, mItem, rss::ElementType::DESCRITION ) );
+
+			// Reset raw Text.
+			mRawText = QByteArray( );
+
+			// Stop
+			break;
+
+		} /// Atom Entry <summary>, <content>
+
+		// </content:encoded>, </dc:creator>, </dc:date>
+		case ITEM_EXTENSION_TEXT:
+		{
+
+			// Store Text.
+			mItem->setExtension( mExtensionTag, text_ );
+
+			// Stop
+			break;
+
+		} /// </content:encoded>, </dc:creator>, </dc:date>
+
+		// </feed>
+		case ATOM_FEED:
+		{
+
+			// Use <id> as Link, if Feed has no <link>.
+			if ( mChannel != nullptr && !mAtomFeedID.isEmpty( ) && mChannel->getElement( rss::ElementType::LINK ) == nullptr )
+				setChannelLink( mAtomFeedID );
+
+			// Reset
+			mAtomFeedID.clear( );
+
+			// Stop
+			break;
+
+		} /// </feed>
 
 		// TextInput Name
 		case RSS_CHANNEL_TEXT_INPUT_NAME:
 		{
 
 			// Cache value.
-			mValues.insert( "name", pText );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_TEXT_INPUT;
+			mValues.insert( "name", text_ );
 
 			// Stop
 			break;
@@ -1123,10 +1839,7 @@ namespace rss
 		{
 
 			// Cache value.
-			mValues.insert( "description", pText );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_TEXT_INPUT;
+			mValues.insert( "description", text_ );
 
 			// Stop
 			break;
@@ -1138,10 +1851,7 @@ namespace rss
 		{
 
 			// Cache value.
-			mValues.insert( "link", pText );
-
-			// Set State.
-			mCurrState = RSS_CHANNEL_TEXT_INPUT;
+			mValues.insert( "link", text_ );
 
 			// Stop
 			break;
@@ -1149,15 +1859,289 @@ namespace rss
 		} /// TextInput Link
 
 
+		// </textInput>
+		case RSS_CHANNEL_TEXT_INPUT:
+		{
+
+			// <title>
+			const QString title_( getValue( "title" ) );
+
+			// <description>
+			const QString description_( getValue( "description" ) );
+
+			// <name>
+			const QString name_( getValue( "name" ) );
+
+			// <link>
+			const QString link_( getValue( "link" ) );
+
+			// Create TextInput Element instance.
+			rss::TextInput *const textInput_( new rss::TextInput( mChannel, title_, description_, name_, link_ ) );
+
+			// Add TextInput to Channel.
+			mChannel->setElement( textInput_ );
+
+			// Clear temp. Values.
+			mValues.clear( );
+
+			// Stop
+			break;
+
+		} /// </textInput>
+
+		// </image>
+		case RSS_CHANNEL_IMAGE:
+		{
+
+			// Url
+			const QUrl url_( getValue( "url" ) );
+
+			// Skip Image without Url (RSS 1.0 <channel> refers to <image> by rdf:resource).
+			if ( url_.isEmpty( ) )
+			{
+				mValues.clear( );
+				break;
+			}
+
+			// Link
+			const QUrl link_( getValue( "link" ) );
+
+			// Title-value.
+			const QString title_( getValue( "title" ) );
+
+			// Description
+			const QString description_( getValue( "description" ) );
+
+			// Width
+			QString value_( getValue( "width" ) );
+			const int width_( value_.isEmpty( ) ? 88 : value_.toInt( ) );
+
+			// Height
+			value_ = getValue( "height" );
+			const int height_( value_.isEmpty( ) ? 31 : value_.toInt( ) );
+
+			// Create Image Element class instance.
+			rss::Image *const image_( new rss::Image( mChannel, &url_, link_.isEmpty( ) ? nullptr : &link_, title_.isEmpty( ) ? nullptr : &title_, description_.isEmpty( ) ? nullptr : &description_, width_, height_ ) );
+
+			// Attach Image to a Channel.
+			mChannel->setElement( image_ );
+
+			// Clear values.
+			mValues.clear( );
+
+			// Stop
+			break;
+
+		} /// </image>
+
+		// </entry>
+		case ATOM_ENTRY:
+		{
+
+			// Use <updated> as pubDate, if Entry has no <published>.
+			if ( mItem != nullptr && !mAtomUpdated.isEmpty( ) && mItem->getElement( rss::ElementType::PUB_DATE ) == nullptr )
+				mItem->setElement( new rss::PubDate( mAtomUpdated, mItem, rss::ElementType::PUB_DATE ) );
+
+			// Reset
+			mAtomUpdated.clear( );
+
+		} /// </entry>
+
+		// fall through
+
+		// </item>
+		case RSS_ITEM_OPEN:
+		case RDF_ITEM:
+		{
+
+			// Use <dc:date> as pubDate, if Item has no <pubDate> (RSS 1.0).
+			if ( mItem != nullptr && mItem->getElement( rss::ElementType::PUB_DATE ) == nullptr )
+			{
+
+				// dc:date
+				const QString date_( mItem->getExtension( TAG_DC_DATE ) );
+
+				// Add Element.
+				if ( !date_.isEmpty( ) )
+					mItem->setElement( new rss::PubDate( date_, mItem, rss::ElementType::PUB_DATE ) );
+
+			} /// Use <dc:date> as pubDate
+
+			// Keep loaded Item, Channel already has it's slot.
+			if ( mLoadItem )
+				break;
+
+			// Add Item to a Channel.
+			if ( mItem != nullptr )
+			{
+
+				// Count added Item, delete rejected (older dublicate).
+				if ( mChannel->addItem( mItem ) )
+					mItemsCount++;
+				else
+					delete mItem;
+
+			} /// Add Item to a Channel.
+
+			// Reset
+			mItem = nullptr;
+
+			// Stop
+			break;
+
+		} /// </item>
+
 		// Default
 		default:
 			break;
 
-		} /// Handle RSS-Document Parsing State (Position).
+		} /// Handle Element end.
+
+		// Restore Parent-Element State.
+		if ( mStates.isEmpty( ) )
+			mCurrState = RSS_DOCUMENT;
+		else
+		{
+			mCurrState = mStates.last( );
+			mStates.pop_back( );
+		}
+
+		// Stop, if Items limit reached.
+		if ( mLimits.mMaxItems > 0 && mItemsCount >= mLimits.mMaxItems )
+			return( onLimitReached( ParseLimits::ITEMS_LIMIT ) );
+
+		// Return TRUE
+		return( true );
+
+	} /// SAXRSSHandler::onEndTag
+
+	/**
+	  * Collects Element Text.
+	  *
+	  * @brief
+	  * Reader can split one Text-node (CDATA, entities) to several calls,
+	  * so Text is appended to buffer & used once, when Element ends.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pChars - Characters.
+	  * @param pLength - number of characters.
+	  * @return - 'true' to continue, 'false' to stop.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::onText( const QChar *const pChars, const int pLength ) noexcept
+	{
+
+		// Cancel, if Element Text ignored.
+		if ( !mTransitions.collectsText( mCurrState ) )
+			return( true );
+
+		// Stop, if Text too long. Text split to several calls counted whole.
+		if ( mLimits.mMaxTextLength > 0 && mText.size( ) + pLength > mLimits.mMaxTextLength )
+			return( onLimitReached( ParseLimits::TEXT_LENGTH_LIMIT ) );
+
+		// Append Text.
+		mText.append( pChars, pLength );
 
 		// Return TRUE
 		return( true );
 
+	} /// SAXRSSHandler::onText
+
+	/**
+	  * Keeps raw Text of current Element, if #defersText.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pBytes - Element content: Text (with entities), CDATA sections & comments.
+	  * @param pLength - number of bytes.
+	  * @param pCharset - table of single-byte charset, null for UTF-8.
+	  * @throws - no exceptions.
+	**/
+	void SAXRSSHandler::onRawText( const char *const pBytes, const int pLength, const ushort *const pCharset ) noexcept
+	{
+
+		// Copy bytes, document memory is released after parsing.
+		mRawText = QByteArray( pBytes, pLength );
+		mRawCharset = pCharset;
+
+	} /// SAXRSSHandler::onRawText
+
+	/**
+	  * Called when element has been read.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param namespaceURI - Namespace.
+	  * @param locaName - Element-Name with Namespace-prefix.
+	  * @param qName - Element-Name (<rss>).
+	  * @param pAttrs - Attributes.
+	  * @return - 'true' to OK, 'false' if error.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::startElement( const QString& namespaceURI, const QString & localName, const QString & qName, const QXmlAttributes & pAttrs )
+	{
+
+#if defined( QT_DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "SAXRSSHandler::startElement: " << qName;
+#endif // DEBUG
+
+		// Resolve Tag.
+		RSSTag tag_( RSSTags::fromName( qName ) );
+
+		// Known Namespace with own prefix (<purl:encoded>).
+		if ( tag_ == TAG_UNKNOWN && !namespaceURI.isEmpty( ) )
+			tag_ = RSSTags::fromNamespace( namespaceURI, localName );
+
+		// Handle Element.
+		return( onStartTag( tag_, pAttrs ) );
+
+	} /// SAXRSSHandler::startElement
+
+	/**
+	  * Called when end of Element reached (</rss>).
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param namespaceURI - Namespace.
+	  * @param locaName - Element-Name with Namespace-prefix.
+	  * @param qName - Element-Name (<rss>).
+	  * @return - 'true' to OK, 'false' if error.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::endElement( const QString& namespaceURI, const QString& localName, const QString& qName )
+	{
+
+		Q_UNUSED( namespaceURI )
+		Q_UNUSED( localName )
+		Q_UNUSED( qName )
+
+#if defined( QT_DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "SAXRSSHandler::endElement: " << qName;
+#endif // DEBUG
+
+		// Handle Element end. State of Parent-Element restored from stack.
+		return( onEndTag( ) );
+
+	} /// SAXRSSHandler::endElement
+
+	/**
+	  * Called when Text collected from Element
+	  * (<link>https://some_site.ko.kr/news/q93ihfrq3h0.html</link>)
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pText - Characters.
+	  * @throws - no exceptions.
+	**/
+	bool SAXRSSHandler::characters( const QString& pText )
+	{
+
+#if defined( QT_DEBUG ) // DEBUG
+		// Debug
+		qDebug( ) << "SAXRSSHandler::characters: " << pText;
+#endif // DEBUG
+
+		// Collect Text. Element created when it ends.
+		return( onText( pText.constData( ), pText.size( ) ) );
+
 	} /// SAXRSSHandler::characters
 
 	/**
@@ -35,11 +35,51 @@
 #include <qstring.h>
 #endif // !QSTRING_H
 
+// Include QByteArray
+#ifndef QBYTEARRAY_H
+#include <qbytearray.h>
+#endif // !QBYTEARRAY_H
+
 // Include QMap
 #ifndef QMAP_H
 #include <qmap.h>
 #endif // !QMAP_H
 
+// Include QVector
+#ifndef QVECTOR_H
+#include <qvector.h>
+#endif // !QVECTOR_H
+
+// Include QSet
+#ifndef QSET_H
+#include <qset.h>
+#endif // !QSET_H
+
+// Include QElapsedTimer
+#ifndef QELAPSEDTIMER_H
+#include <qelapsedtimer.h>
+#endif // !QELAPSEDTIMER_H
+
+// Include rss::RSSTags
+#ifndef QRSS_READER_RSS_TAGS_HPP
+#include "RSSTags.hpp"
+#endif // !QRSS_READER_RSS_TAGS_HPP
+
+// Include rss::ParseLimits
+#ifndef QRSS_READER_PARSE_LIMITS_HPP
+#include "ParseLimits.hpp"
+#endif // !QRSS_READER_PARSE_LIMITS_HPP
+
+// Include rss::ParseDiagnostics
+#ifndef QRSS_READER_PARSE_DIAGNOSTICS_HPP
+#include "ParseDiagnostics.hpp"
+#endif // !QRSS_READER_PARSE_DIAGNOSTICS_HPP
+
+// Include rss::ParseStats
+#ifndef QRSS_READER_PARSE_STATS_HPP
+#include "ParseStats.hpp"
+#endif // !QRSS_READER_PARSE_STATS_HPP
+
 // ===========================================================
 // FORWARD-DECLARATIONS
 // ===========================================================
@@ -50,6 +90,12 @@ namespace rss { struct Channel; }
 #define QRSS_READER_CHANNEL_DECL
 #endif // !QRSS_READER_CHANNEL_DECL
 
+// Forward-declare rss::ElementArena
+#ifndef QRSS_READER_ELEMENT_ARENA_DECL
+#define QRSS_READER_ELEMENT_ARENA_DECL
+namespace rss { class ElementArena; }
+#endif // !QRSS_READER_ELEMENT_ARENA_DECL
+
 // Forward-declare rss::Item
 #ifndef QRSS_READER_ITEM_DECL
 #define QRSS_READER_ITEM_DECL
@@ -139,6 +185,7 @@ namespace rss
 
 	/**
 	  * SAXRSSHandler - handles SAX reading of RSS document (file).
+	  * Atom 1.0 & RSS 1.0 (RDF) Feeds mapped to the same Channel & Item Elements.
 	  *
 	  * @brief
 	  * SAX is the preferred XML reading-method due to stop (cancel, abort) action.
@@ -307,10 +354,77 @@ namespace rss
 			RSS_ITEM_TITLE,
 
 			/** RSS Item Description. **/
-			RSS_ITEM_DESCRIPTION
+			RSS_ITEM_DESCRIPTION,
+
+			/** Atom <feed>, Channel. **/
+			ATOM_FEED,
+
+			/** Atom Feed <id>, used as Channel Link if no <link>. **/
+			ATOM_FEED_ID,
+
+			/** Atom Feed <link rel="alternate" href="" />. **/
+			ATOM_FEED_LINK,
+
+			/** Atom <entry>, Item. **/
+			ATOM_ENTRY,
+
+			/** Atom Entry <link rel="alternate" href="" />. **/
+			ATOM_ENTRY_LINK,
+
+			/** Atom Entry <updated>, used as pubDate if no <published>. **/
+			ATOM_ENTRY_UPDATED,
+
+			/** Atom Entry <summary> or <content>, first one used as Description. **/
+			ATOM_ENTRY_CONTENT,
+
+			/** Element inside Atom Entry <content type="xhtml">, it's Text added to <content> Text. **/
+			ATOM_ENTRY_CONTENT_MARKUP,
+
+			/** Atom Entry <category term="" scheme="" />. **/
+			ATOM_ENTRY_CATEGORY,
+
+			/** RSS 1.0 <rdf:RDF> root-Element, <channel> & <item> are it's children. **/
+			RDF_ROOT,
+
+			/** RSS 1.0 <item rdf:about="">, sibling of <channel>. **/
+			RDF_ITEM,
+
+			/** Item extension with Text (<content:encoded>, <dc:creator>, <dc:date>). **/
+			ITEM_EXTENSION_TEXT,
+
+			/** Item extension with url Attribute (<media:thumbnail>, <media:content>). **/
+			ITEM_EXTENSION_URL,
+
+			/** Item <media:group>. **/
+			ITEM_MEDIA_GROUP,
+
+			/** Before root-Element. **/
+			RSS_DOCUMENT,
+
+			/** <rss> root-Element. **/
+			RSS_ROOT,
+
+			/** Unknown Element. Text & sub-Elements ignored. **/
+			RSS_SKIP,
+
+			/** Number of Positions. **/
+			RSS_POSITIONS_COUNT
 
 		}; // rss::SAXRSSHandler::RSSPosition
 
+		// ===========================================================
+		// TransitionTable
+		// ===========================================================
+
+		/**
+		  * (RSSPosition x RSSTag) to RSSPosition table.
+		  * Built once, see SAXRSSHandler.cpp.
+		**/
+		struct TransitionTable;
+
+		/** Position Transitions. **/
+		static const TransitionTable mTransitions;
+
 		// ===========================================================
 		// FIELDS
 		// ===========================================================
@@ -321,8 +435,20 @@ namespace rss
 		/** State. **/
 		RSSPosition mCurrState;
 
-		/** Previous State. Used to fallback neither to Channel or Item State-ID. **/
-		RSSPosition mPrevState;
+		/** Parent-Elements States. Restored when Element ends. **/
+		QVector<RSSPosition> mStates;
+
+		/** Initial capacity of Text-buffer. **/
+		static constexpr int TEXT_BUFFER_CAPACITY = 4096;
+
+		/** Text of current Element. Reused for all Elements. **/
+		QString mText;
+
+		/** Raw Text of current Element (Item Description), decoded on first use. Null if Text decoded. **/
+		QByteArray mRawText;
+
+		/** Table of single-byte charset of raw Text, null for UTF-8. **/
+		const ushort * mRawCharset;
 
 		/** Values Map. Used to avoid declaring sets of temp. variables. **/
 		QMap<QString, QString> mValues;
@@ -330,13 +456,82 @@ namespace rss
 		/** Item. **/
 		rss::Item * mItem;
 
-		/** ChannelModel. **/
+		/** ChannelModel. Null for staging Handler. **/
 		rss::ChannelModel *const mChannelModel;
 
+		/** 'true' when Channel added to ChannelModel, or merged with added Channel (<link> parsed). **/
+		bool mChannelAdded;
+
+		/** Number of Items added to Channel. **/
+		int mItemsCount;
+
+		/** Atom Feed <id>. **/
+		QString mAtomFeedID;
+
+		/** Atom Entry <updated>. **/
+		QString mAtomUpdated;
+
+		/** Tag of current Item extension with Text. **/
+		RSSTag mExtensionTag;
+
+		/** File-Path of indexed Items. Items not loaded, if set. **/
+		QString mIndexPath;
+
+		/** Size of File with indexed Items. **/
+		qint64 mIndexSize;
+
+		/** Modification time (ms since epoch) of File with indexed Items. **/
+		qint64 mIndexModified;
+
+		/** 'true' when single Item loaded, Item kept instead of adding to Channel. **/
+		bool mLoadItem;
+
+		/** 'true' if reader hashes Item bytes (#onItemHashed). **/
+		bool mHashItems;
+
+		/** Hashes of Items bytes, read from the same source before. Matching Items skipped. **/
+		QSet<quint64> mKnownItems;
+
+		/** Hashes of Items bytes, read now. **/
+		QSet<quint64> mItemHashes;
+
+		/** Parsing limits. **/
+		ParseLimits mLimits;
+
+		/** Parsing time, started when limits set. **/
+		QElapsedTimer mParseTimer;
+
+		/** Limit, which stopped parsing. **/
+		ParseLimits::LimitType mExceededLimit;
+
+		/** 'true' if malformed Items dropped & parsing continued. **/
+		bool mRecovery;
+
+		/** Parsing problems. **/
+		ParseDiagnostics mDiagnostics;
+
+		/** Parsing statistics. **/
+		ParseStats mStats;
+
+		/** Arena, bound to thread before Handler created. Restored, when Handler destructed. **/
+		ElementArena * mPrevArena;
+
+		/** 'true' if Elements allocated from Channel Arena, 'false' to use heap & Elements pools. **/
+		bool mUseArena;
+
 		// ===========================================================
 		// METHODS
 		// ===========================================================
 
+		/**
+		  * Records error, which stopped parsing. First error kept.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pException - error details.
+		  * @throws - no exceptions.
+		**/
+		void setError( const QXmlParseException & pException ) noexcept;
+
 		/**
 		  * Search Attribute.
 		  *
@@ -358,6 +553,25 @@ namespace rss
 		**/
 		QString getValue( const QString & pName ) const noexcept;
 
+		/**
+		  * Returns href of Atom <link>, if it's alternate (page) link.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pAttrs - Attributes.
+		  * @return - href, or empty QString for "self", "enclosure", etc.
+		  * @throws - no exceptions.
+		**/
+		static QString getAtomLink( const QXmlAttributes & pAttrs ) noexcept;
+
+		/**
+		  * Sets Channel Link & adds Channel to ChannelModel.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pUrl - Link.
+		  * @throws - no exceptions.
+		**/
+		void setChannelLink( const QString & pUrl ) noexcept;
+
 		// -----------------------------------------------------------
 
 	public:
@@ -372,7 +586,7 @@ namespace rss
 		  * SAXRSSHandler constructor.
 		  *
 		  * @param pChannel - Channel-class to update directly.
-		  * @param pModel - ChannelModel.
+		  * @param pModel - ChannelModel, or null to fill own (staging) Channel only.
 		  * @throws - no exceptions.
 		**/
 		explicit SAXRSSHandler( rss::Channel *const pChannel, rss::ChannelModel *const pModel ) noexcept;
@@ -393,7 +607,8 @@ namespace rss
 		// ===========================================================
 
 		/**
-		  * Returns RSS Channel-class instance.
+		  * Returns RSS Channel-class instance & releases ownership.
+		  * Item, not closed when parsing stopped, deleted.
 		  *
 		  * @threadsafe - not thread-safe.
 		  * @return - Channel, or null if RSS document is invalid.
@@ -401,6 +616,350 @@ namespace rss
 		**/
 		rss::Channel * getChannel( ) noexcept;
 
+		/**
+		  * Takes Item, loaded after #beginItem.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - Item, or null if not loaded.
+		  * @throws - no exceptions.
+		**/
+		rss::Item * takeItem( ) noexcept;
+
+		/**
+		  * Returns number of Items added to Channel so far.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - number of closed (</item>) Items.
+		  * @throws - no exceptions.
+		**/
+		int countItems( ) const noexcept;
+
+		/**
+		  * Returns 'true' when Channel added to ChannelModel,
+		  * or merged with added Channel (<link> parsed).
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		bool isChannelAdded( ) const noexcept;
+
+		/**
+		  * Returns parsing limits.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - ParseLimits.
+		  * @throws - no exceptions.
+		**/
+		const ParseLimits & getLimits( ) const noexcept;
+
+		/**
+		  * Returns limit, which stopped parsing.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - LimitType, NO_LIMIT if document parsed whole (or failed).
+		  * @throws - no exceptions.
+		**/
+		ParseLimits::LimitType getExceededLimit( ) const noexcept;
+
+		/**
+		  * Returns 'true' if recovery mode enabled.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		bool recovers( ) const noexcept;
+
+		/**
+		  * Returns 'true' if Elements allocated from Channel Arena.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		bool usesArena( ) const noexcept;
+
+		/**
+		  * Returns parsing problems.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - ParseDiagnostics.
+		  * @throws - no exceptions.
+		**/
+		const ParseDiagnostics & getDiagnostics( ) const noexcept;
+
+		/**
+		  * Returns parsing statistics.
+		  * Elements & Items counted by Handler, bytes & times set by reader.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - ParseStats.
+		  * @throws - no exceptions.
+		**/
+		ParseStats & getStats( ) noexcept;
+
+		/**
+		  * Returns hashes of Items bytes, which Items skipped.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - hashes.
+		  * @throws - no exceptions.
+		**/
+		const QSet<quint64> & getKnownItems( ) const noexcept;
+
+		/**
+		  * Returns hashes of Items bytes, read by reader.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - hashes.
+		  * @throws - no exceptions.
+		**/
+		QSet<quint64> & getItemHashes( ) noexcept;
+
+		// ===========================================================
+		// SETTERS
+		// ===========================================================
+
+		/**
+		  * Enables Items indexing: only Item bytes location recorded,
+		  * Items loaded later with #beginItem.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pPath - File-Path, or empty QString to load Items.
+		  * @param pSize - File size, checked when Item loaded.
+		  * @param pModified - File modification time (ms since epoch), checked when Item loaded.
+		  * @throws - no exceptions.
+		**/
+		void setItemsIndex( const QString & pPath, const qint64 pSize = 0, const qint64 pModified = 0 ) noexcept;
+
+		/**
+		  * Enables Items hashing: reader hashes bytes of every Item,
+		  * Items with known hash (read from the same source before) not built.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pHashes - hashes of Items bytes, added before.
+		  * @throws - no exceptions.
+		**/
+		void setKnownItems( const QSet<quint64> & pHashes ) noexcept;
+
+		/**
+		  * Prepares Handler to load single Item from it's bytes.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pParentTag - Item Parent-Element Tag (<channel>, <feed>, <rdf:RDF>).
+		  * @throws - no exceptions.
+		**/
+		void beginItem( const RSSTag pParentTag ) noexcept;
+
+		/**
+		  * Sets parsing limits & starts parsing time.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pLimits - ParseLimits.
+		  * @throws - no exceptions.
+		**/
+		void setLimits( const ParseLimits & pLimits ) noexcept;
+
+		/**
+		  * Enables recovery mode: malformed Item dropped,
+		  * reader continues from the next Item.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pRecovery - 'true' to recover.
+		  * @throws - no exceptions.
+		**/
+		void setRecovery( const bool pRecovery ) noexcept;
+
+		/**
+		  * Enables Channel Arena. Disabled, when File read again:
+		  * rejected (not newer) Items would keep Arena memory until Channel deleted,
+		  * so Elements allocated on heap & Elements pools.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pUseArena - 'true' to allocate Elements from Channel Arena (default).
+		  * @throws - no exceptions.
+		**/
+		void setUseArena( const bool pUseArena ) noexcept;
+
+		/**
+		  * Binds Arena of Channel to thread, so Elements allocated from it.
+		  * Single loaded Item, or Channel without Arena (#setUseArena) allocated on heap.
+		  *
+		  * (?) Handler, kept between event-loop turns (incremental parsing),
+		  * bound before each chunk. Caller restores previous Arena after chunk.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		void bindArena( ) noexcept;
+
+		/**
+		  * Sets parsing problems, found by staging Handler.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pDiagnostics - ParseDiagnostics.
+		  * @throws - no exceptions.
+		**/
+		void setDiagnostics( const ParseDiagnostics & pDiagnostics ) noexcept;
+
+		// ===========================================================
+		// EVENTS
+		// ===========================================================
+
+		/**
+		  * Returns 'true' if Text of current Element is used.
+		  * Lets reader skip decoding of ignored Text.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if Text collected, 'false' if ignored.
+		  * @throws - no exceptions.
+		**/
+		bool collectsText( ) const noexcept;
+
+		/**
+		  * Returns 'true' if raw Text of current Element can be kept,
+		  * & decoded when it's displayed (Item Description).
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pLength - number of raw bytes.
+		  * @return - 'true' to pass raw Text with #onRawText, 'false' to decode it.
+		  * @throws - no exceptions.
+		**/
+		bool defersText( const qint64 pLength ) const noexcept;
+
+		/**
+		  * Returns 'true' if Attributes of Element are used.
+		  * Lets reader skip Attributes decoding.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pTag - Element Tag, child of current Element.
+		  * @return - 'true' if Attributes read, 'false' if ignored.
+		  * @throws - no exceptions.
+		**/
+		bool usesAttributes( const RSSTag pTag ) const noexcept;
+
+		/**
+		  * Returns 'true' if Element is Item & Items indexed.
+		  * Reader then skips Item & calls #onItemSkipped.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pTag - Element Tag, child of current Element.
+		  * @return - 'true' to skip Element.
+		  * @throws - no exceptions.
+		**/
+		bool skipsItem( const RSSTag pTag ) const noexcept;
+
+		/**
+		  * Returns 'true' if Element is Item (<item>, <entry>).
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pTag - Element Tag, child of current Element.
+		  * @throws - no exceptions.
+		**/
+		bool opensItem( const RSSTag pTag ) const noexcept;
+
+		/**
+		  * Records skipped Item.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pOffset - Offset of Item in File.
+		  * @param pLength - number of bytes.
+		  * @param pCharset - table of Document single-byte charset, null for UTF-8.
+		  * @return - 'true' to continue, 'false' to stop.
+		  * @throws - no exceptions.
+		**/
+		bool onItemSkipped( const qint64 pOffset, const int pLength, const ushort *const pCharset ) noexcept;
+
+		/**
+		  * Returns 'true' if reader passes hash of every Item bytes (#onItemHashed).
+		  * Not used, when Items indexed.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @throws - no exceptions.
+		**/
+		bool hashesItems( ) const noexcept;
+
+		/**
+		  * Records hash of Item bytes.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pHash - hash of Item bytes, start-tag to end-tag.
+		  * @return - 'true' if Item known & must be skipped, 'false' to read it.
+		  * @throws - no exceptions.
+		**/
+		bool onItemHashed( const quint64 pHash ) noexcept;
+
+		/**
+		  * Records reached limit. Items accepted so far are kept.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pLimit - LimitType.
+		  * @return - 'false', to stop parsing.
+		  * @throws - no exceptions.
+		**/
+		bool onLimitReached( const ParseLimits::LimitType pLimit ) noexcept;
+
+		/**
+		  * Drops malformed Item, continues from Items Parent-Element.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pDepth - number of open Elements, including Items Parent-Element.
+		  * @param pOffset - Offset of dropped bytes.
+		  * @param pLength - number of dropped bytes.
+		  * @throws - no exceptions.
+		**/
+		void onRecovered( const int pDepth, const qint64 pOffset, const qint64 pLength ) noexcept;
+
+		/**
+		  * Handles Element start.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pTag - Element Tag.
+		  * @param pAttrs - Attributes.
+		  * @return - 'true' to continue, 'false' to stop.
+		  * @throws - no exceptions.
+		**/
+		bool onStartTag( const RSSTag pTag, const QXmlAttributes & pAttrs ) noexcept;
+
+		/**
+		  * Handles Element end.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' to continue, 'false' to stop.
+		  * @throws - no exceptions.
+		**/
+		bool onEndTag( ) noexcept;
+
+		/**
+		  * Collects Element Text.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pChars - Characters.
+		  * @param pLength - number of characters.
+		  * @return - 'true' to continue, 'false' to stop.
+		  * @throws - no exceptions.
+		**/
+		bool onText( const QChar *const pChars, const int pLength ) noexcept;
+
+		/**
+		  * Keeps raw Text of current Element, if #defersText.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pBytes - Element content: Text (with entities), CDATA sections & comments.
+		  * @param pLength - number of bytes.
+		  * @param pCharset - table of single-byte charset, null for UTF-8.
+		  * @throws - no exceptions.
+		**/
+		void onRawText( const char *const pBytes, const int pLength, const ushort *const pCharset ) noexcept;
+
+		/**
+		  * Takes Channel, filled by staging Handler.
+		  * Channel added to ChannelModel, or merged with own Channel.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pChannel - Channel. Ownership transfered.
+		  * @throws - no exceptions.
+		**/
+		void adoptChannel( rss::Channel *const pChannel ) noexcept;
+
 		// ===========================================================
 		// OVERRIDE: QXmlDefaultHandler
 		// ===========================================================
@@ -496,6 +1055,8 @@ namespace rss
 
 } // rss
 
+#define QRSS_READER_SAX_RSS_HANDLER_DECL
+
 // -----------------------------------------------------------
 
 #endif // !QRSS_READER_SAX_RSS_HANDLER_HPP
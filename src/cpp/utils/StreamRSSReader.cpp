@@ -0,0 +1,328 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef QRSS_READER_STREAM_RSS_READER_HPP
+#include "StreamRSSReader.hpp"
+#endif // !QRSS_READER_STREAM_RSS_READER_HPP
+
+// Include rss::SAXRSSHandler
+#ifndef QRSS_READER_SAX_RSS_HANDLER_HPP
+#include "SAXRSSHandler.hpp"
+#endif // !QRSS_READER_SAX_RSS_HANDLER_HPP
+
+// Include rss::RSSTags
+#ifndef QRSS_READER_RSS_TAGS_HPP
+#include "RSSTags.hpp"
+#endif // !QRSS_READER_RSS_TAGS_HPP
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+
+// Include QDebug
+#ifndef QDEBUG_H
+#include <qdebug.h>
+#endif // !QDEBUG_H
+
+#endif // DEBUG
+
+// ===========================================================
+// rss::StreamRSSReader
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	// ===========================================================
+	// CONSTRUCTOR
+	// ===========================================================
+
+	/**
+	  * StreamRSSReader constructor.
+	  *
+	  * @param pHandler - RSS Handler.
+	  * @throws - no exceptions.
+	**/
+	StreamRSSReader::StreamRSSReader( rss::SAXRSSHandler *const pHandler ) noexcept
+		: mReader( ),
+		  mHandler( pHandler ),
+		  mAttributes( ),
+		  mIncremental( false )
+	{
+
+#if defined( QT_DEBUG ) || defined( DEBUG ) // DEBUG
+		// Check Handler instance.
+		assert( pHandler != nullptr && "StreamRSSReader::constructor - SAXRSSHandler is null !" );
+#endif // DEBUG
+
+	}
+
+	// ===========================================================
+	// DESTRUCTOR
+	// ===========================================================
+
+	/**
+	  * StreamRSSReader destructor.
+	  *
+	  * @throws - no exceptions.
+	**/
+	StreamRSSReader::~StreamRSSReader( ) noexcept = default;
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Parse RSS-document from Device (File).
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pDevice - Device to read from.
+	  * @return - 'true' if document parsed, 'false' if error.
+	  * @throws - no exceptions.
+	**/
+	bool StreamRSSReader::parse( QIODevice *const pDevice ) noexcept
+	{
+
+		// Whole Document available.
+		mIncremental = false;
+
+		// Set Device.
+		mReader.setDevice( pDevice );
+
+		// Read Tokens.
+		return( readTokens( ) );
+
+	} /// StreamRSSReader::parse
+
+	/**
+	  * Appends chunk of RSS-document.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @param pData - Document bytes.
+	  * @throws - no exceptions.
+	**/
+	void StreamRSSReader::addData( const QByteArray & pData ) noexcept
+	{
+
+		// Document fed by chunks.
+		mIncremental = true;
+
+		// Add Data.
+		mReader.addData( pData );
+
+	} /// StreamRSSReader::addData
+
+	/**
+	  * Parses data added by #addData.
+	  * Element split between chunks handled when next chunk added.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if no errors so far, 'false' if error.
+	  * @throws - no exceptions.
+	**/
+	bool StreamRSSReader::parseContinue( ) noexcept
+	{ return( readTokens( ) ); }
+
+	/**
+	  * Called when all chunks added.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if document complete, 'false' if error or truncated.
+	  * @throws - no exceptions.
+	**/
+	bool StreamRSSReader::finish( ) noexcept
+	{
+
+		// No more Data.
+		mIncremental = false;
+
+		// Report truncated Document.
+		if ( mReader.error( ) == QXmlStreamReader::PrematureEndOfDocumentError )
+		{
+
+			// Forward Error to Handler.
+			mHandler->fatalError( QXmlParseException( mReader.errorString( ), static_cast<int>( mReader.columnNumber( ) ), static_cast<int>( mReader.lineNumber( ) ) ) );
+
+			// Return FALSE
+			return( false );
+
+		} /// Report truncated Document.
+
+		// Return TRUE, if no errors.
+		return( !mReader.hasError( ) );
+
+	} /// StreamRSSReader::finish
+
+	/**
+	  * Reads tokens until end of document, error or handler stop.
+	  *
+	  * @threadsafe - not thread-safe.
+	  * @return - 'true' if document parsed, 'false' if error.
+	  * @throws - no exceptions.
+	**/
+	bool StreamRSSReader::readTokens( ) noexcept
+	{
+
+		// Read Tokens.
+		while( !mReader.atEnd( ) )
+		{
+
+			// Handle Token.
+			switch( mReader.readNext( ) )
+			{
+
+			// Document start.
+			case QXmlStreamReader::StartDocument:
+			{
+
+				// Stop, if Handler cancels parsing.
+				if ( !mHandler->startDocument( ) )
+					return( false );
+
+				// Stop
+				break;
+
+			} /// Document start.
+
+			// <element>
+			case QXmlStreamReader::StartElement:
+			{
+
+				// Qualified Name, resolved in Reader buffer without copy.
+				const QStringRef qName_( mReader.qualifiedName( ) );
+
+				// Resolve Tag.
+				RSSTag tag_( RSSTags::fromName( qName_.unicode( ), qName_.size( ) ) );
+
+				// Known Namespace with own prefix (<purl:encoded>).
+				if ( tag_ == TAG_UNKNOWN && !mReader.namespaceUri( ).isEmpty( ) )
+					tag_ = RSSTags::fromNamespace( mReader.namespaceUri( ), mReader.name( ) );
+
+				// Reset Attributes.
+				if ( mAttributes.count( ) > 0 )
+					mAttributes.clear( );
+
+				// Copy Attributes, only when Handler uses them.
+				if ( mHandler->usesAttributes( tag_ ) )
+				{
+
+					// Copy Attributes.
+					for( const QXmlStreamAttribute & attr_ : mReader.attributes( ) )
+						mAttributes.append( attr_.qualifiedName( ).toString( ), attr_.namespaceUri( ).toString( ), attr_.name( ).toString( ), attr_.value( ).toString( ) );
+
+				} /// Copy Attributes
+
+				// Forward to Handler.
+				if ( !mHandler->onStartTag( tag_, mAttributes ) )
+					return( false );
+
+				// Stop
+				break;
+
+			} /// <element>
+
+			// </element>
+			case QXmlStreamReader::EndElement:
+			{
+
+				// Forward to Handler. State of Parent-Element restored from stack, so name not needed.
+				if ( !mHandler->onEndTag( ) )
+					return( false );
+
+				// Stop
+				break;
+
+			} /// </element>
+
+			// Text & CDATA.
+			case QXmlStreamReader::Characters:
+			{
+
+				// Text in Reader buffer.
+				const QStringRef text_( mReader.text( ) );
+
+				// Forward to Handler.
+				if ( !mHandler->onText( text_.unicode( ), text_.size( ) ) )
+					return( false );
+
+				// Stop
+				break;
+
+			} /// Text & CDATA.
+
+			// Document end.
+			case QXmlStreamReader::EndDocument:
+			{
+
+				// Stop, if Handler cancels parsing.
+				if ( !mHandler->endDocument( ) )
+					return( false );
+
+				// Stop
+				break;
+
+			} /// Document end.
+
+			// Default
+			default:
+				break;
+
+			} /// Handle Token.
+
+		} /// Read Tokens.
+
+		// Wait for next chunk.
+		if ( mIncremental && mReader.error( ) == QXmlStreamReader::PrematureEndOfDocumentError )
+			return( true );
+
+		// Report Error.
+		if ( mReader.hasError( ) )
+		{
+
+#if defined( QT_DEBUG ) // DEBUG
+			// Debug
+			qDebug( ) << "StreamRSSReader::readTokens - error=" << mReader.errorString( );
+#endif // DEBUG
+
+			// Forward Error to Handler.
+			mHandler->fatalError( QXmlParseException( mReader.errorString( ), static_cast<int>( mReader.columnNumber( ) ), static_cast<int>( mReader.lineNumber( ) ) ) );
+
+			// Return FALSE
+			return( false );
+
+		} /// Report Error.
+
+		// Return TRUE
+		return( true );
+
+	} /// StreamRSSReader::readTokens
+
+	// -----------------------------------------------------------
+
+} // rss
+
+// -----------------------------------------------------------
@@ -0,0 +1,220 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_STREAM_RSS_READER_HPP
+#define QRSS_READER_STREAM_RSS_READER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include QXmlStreamReader
+#ifndef QXMLSTREAM_H
+#include <QXmlStreamReader>
+#endif // !QXMLSTREAM_H
+
+// Include QtXml
+#include <QtXml> // QXmlAttributes, QXmlParseException
+
+// Include QByteArray
+#ifndef QBYTEARRAY_H
+#include <qbytearray.h>
+#endif // !QBYTEARRAY_H
+
+// ===========================================================
+// FORWARD-DECLARATIONS
+// ===========================================================
+
+// Forward-declare QIODevice
+#if !defined( QIODEVICE_H ) && !defined( QIODEVICE_DECL )
+#define QIODEVICE_DECL
+class QIODevice;
+#endif // !QIODEVICE_H
+
+// Forward-declare rss::SAXRSSHandler
+#ifndef QRSS_READER_SAX_RSS_HANDLER_DECL
+#define QRSS_READER_SAX_RSS_HANDLER_DECL
+namespace rss { class SAXRSSHandler; }
+#endif // !QRSS_READER_SAX_RSS_HANDLER_DECL
+
+// ===========================================================
+// rss::StreamRSSReader
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * StreamRSSReader - pull-parser engine for RSS documents.
+	  *
+	  * @brief
+	  * Alternative to QXmlSimpleReader, built on QXmlStreamReader.
+	  * Pulls tokens & forwards them to the same SAXRSSHandler, so both
+	  * engines fill the same rss::Channel & rss::Item objects.
+	  * Element-Names resolved to rss::RSSTag in Reader buffer, without QString copies.
+	  * Attributes are converted only for Elements which Handler reads them from,
+	  * one QXmlAttributes instance reused for the whole document.
+	  * Document can be parsed from Device, or fed by chunks
+	  * (#addData, #parseContinue, #finish).
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	class StreamRSSReader final
+	{
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// FIELDS
+		// ===========================================================
+
+		/** Xml Pull-Parser. **/
+		QXmlStreamReader mReader;
+
+		/** RSS Handler to forward parsing events to. **/
+		rss::SAXRSSHandler *const mHandler;
+
+		/** Attributes. Reused for every Element to avoid allocations. **/
+		QXmlAttributes mAttributes;
+
+		/** 'true' if Document fed by chunks, so premature end is not an error until #finish. **/
+		bool mIncremental;
+
+		// ===========================================================
+		// DELETED CONSTRUCTORS & OPERATORS
+		// ===========================================================
+
+		/** @deleted StreamRSSReader const copy constructor. **/
+		StreamRSSReader( const StreamRSSReader & ) noexcept = delete;
+
+		/** @deleted StreamRSSReader copy-assignment operator. **/
+		StreamRSSReader & operator=( const StreamRSSReader & ) noexcept = delete;
+
+		/** @deleted StreamRSSReader move constructor. **/
+		StreamRSSReader( StreamRSSReader && ) noexcept = delete;
+
+		/** @deleted StreamRSSReader move assignment operator. **/
+		StreamRSSReader & operator=( StreamRSSReader && ) noexcept = delete;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Reads tokens until end of document, error or handler stop.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if document parsed, 'false' if error.
+		  * @throws - no exceptions.
+		**/
+		bool readTokens( ) noexcept;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// CONSTRUCTOR
+		// ===========================================================
+
+		/**
+		  * StreamRSSReader constructor.
+		  *
+		  * @param pHandler - RSS Handler.
+		  * @throws - no exceptions.
+		**/
+		explicit StreamRSSReader( rss::SAXRSSHandler *const pHandler ) noexcept;
+
+		// ===========================================================
+		// DESTRUCTOR
+		// ===========================================================
+
+		/**
+		  * StreamRSSReader destructor.
+		  *
+		  * @throws - no exceptions.
+		**/
+		~StreamRSSReader( ) noexcept;
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Parse RSS-document from Device (File).
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pDevice - Device to read from.
+		  * @return - 'true' if document parsed, 'false' if error.
+		  * @throws - no exceptions.
+		**/
+		bool parse( QIODevice *const pDevice ) noexcept;
+
+		/**
+		  * Appends chunk of RSS-document.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @param pData - Document bytes.
+		  * @throws - no exceptions.
+		**/
+		void addData( const QByteArray & pData ) noexcept;
+
+		/**
+		  * Parses data added by #addData.
+		  * Element split between chunks handled when next chunk added.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if no errors so far, 'false' if error.
+		  * @throws - no exceptions.
+		**/
+		bool parseContinue( ) noexcept;
+
+		/**
+		  * Called when all chunks added.
+		  *
+		  * @threadsafe - not thread-safe.
+		  * @return - 'true' if document complete, 'false' if error or truncated.
+		  * @throws - no exceptions.
+		**/
+		bool finish( ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // rss::StreamRSSReader
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_STREAM_RSS_READER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_STREAM_RSS_READER_HPP
@@ -0,0 +1,232 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef QRSS_READER_XXHASH64_HPP
+#include "XXHash64.hpp"
+#endif // !QRSS_READER_XXHASH64_HPP
+
+// Include C++ string functions (memcpy).
+#include <cstring>
+
+// ===========================================================
+// rss::XXHash64
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	namespace
+	{
+
+		/** XXH64 primes. **/
+		constexpr quint64 PRIME_1 = 0x9E3779B185EBCA87ULL;
+		constexpr quint64 PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr quint64 PRIME_3 = 0x165667B19E3779F9ULL;
+		constexpr quint64 PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr quint64 PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+		/**
+		  * Rotates bits left.
+		  *
+		  * @param pValue - value.
+		  * @param pBits - number of bits.
+		  * @return - rotated value.
+		**/
+		inline quint64 rotateLeft( const quint64 pValue, const int pBits ) noexcept
+		{ return( ( pValue << pBits ) | ( pValue >> ( 64 - pBits ) ) ); }
+
+		/**
+		  * Reads little-endian 64-bit value.
+		  *
+		  * @param pBytes - bytes, not aligned.
+		  * @return - value.
+		**/
+		inline quint64 read64( const uchar *const pBytes ) noexcept
+		{
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+			// Copy, compiler emits single load.
+			quint64 result_;
+			std::memcpy( &result_, pBytes, sizeof( result_ ) );
+			return( result_ );
+#else // BIG ENDIAN
+			// Compose bytes.
+			quint64 result_( 0 );
+			for( int i = 7; i >= 0; i-- )
+				result_ = ( result_ << 8 ) | pBytes[i];
+			return( result_ );
+#endif // Q_BYTE_ORDER
+
+		}
+
+		/**
+		  * Reads little-endian 32-bit value.
+		  *
+		  * @param pBytes - bytes, not aligned.
+		  * @return - value.
+		**/
+		inline quint64 read32( const uchar *const pBytes ) noexcept
+		{ return( static_cast<quint64>( pBytes[0] ) | ( static_cast<quint64>( pBytes[1] ) << 8 ) | ( static_cast<quint64>( pBytes[2] ) << 16 ) | ( static_cast<quint64>( pBytes[3] ) << 24 ) ); }
+
+		/**
+		  * Mixes 8 bytes to lane.
+		  *
+		  * @param pLane - lane accumulator.
+		  * @param pInput - input value.
+		  * @return - new accumulator.
+		**/
+		inline quint64 round( quint64 pLane, const quint64 pInput ) noexcept
+		{
+
+			pLane += pInput * PRIME_2;
+			pLane = rotateLeft( pLane, 31 );
+			return( pLane * PRIME_1 );
+
+		}
+
+		/**
+		  * Merges lane to hash.
+		  *
+		  * @param pHash - hash.
+		  * @param pLane - lane accumulator.
+		  * @return - new hash.
+		**/
+		inline quint64 mergeRound( quint64 pHash, const quint64 pLane ) noexcept
+		{
+
+			pHash ^= round( 0, pLane );
+			return( pHash * PRIME_1 + PRIME_4 );
+
+		}
+
+	} // namespace
+
+	// ===========================================================
+	// METHODS
+	// ===========================================================
+
+	/**
+	  * Computes hash of bytes.
+	  *
+	  * @threadsafe - thread-safe.
+	  * @param pData - bytes.
+	  * @param pSize - number of bytes.
+	  * @param pSeed - seed.
+	  * @return - 64-bit hash.
+	  * @throws - no exceptions.
+	**/
+	quint64 XXHash64::hash( const void *const pData, const size_t pSize, const quint64 pSeed ) noexcept
+	{
+
+		// Bytes
+		const uchar * pos_( static_cast<const uchar*>( pData ) );
+		const uchar *const end_( pos_ + pSize );
+
+		// Hash
+		quint64 result_( 0 );
+
+		// 32 bytes per step, 4 lanes.
+		if ( pSize >= 32 )
+		{
+
+			// Lanes
+			quint64 lane1_( pSeed + PRIME_1 + PRIME_2 );
+			quint64 lane2_( pSeed + PRIME_2 );
+			quint64 lane3_( pSeed );
+			quint64 lane4_( pSeed - PRIME_1 );
+
+			// Last step start.
+			const uchar *const last_( end_ - 32 );
+
+			// Mix stripes.
+			do
+			{
+				lane1_ = round( lane1_, read64( pos_ ) );
+				lane2_ = round( lane2_, read64( pos_ + 8 ) );
+				lane3_ = round( lane3_, read64( pos_ + 16 ) );
+				lane4_ = round( lane4_, read64( pos_ + 24 ) );
+				pos_ += 32;
+			}
+			while( pos_ <= last_ );
+
+			// Converge lanes.
+			result_ = rotateLeft( lane1_, 1 ) + rotateLeft( lane2_, 7 ) + rotateLeft( lane3_, 12 ) + rotateLeft( lane4_, 18 );
+			result_ = mergeRound( result_, lane1_ );
+			result_ = mergeRound( result_, lane2_ );
+			result_ = mergeRound( result_, lane3_ );
+			result_ = mergeRound( result_, lane4_ );
+
+		} /// 32 bytes per step, 4 lanes.
+		else
+			result_ = pSeed + PRIME_5;
+
+		// Add length.
+		result_ += static_cast<quint64>( pSize );
+
+		// Tail: 8 bytes.
+		while( end_ - pos_ >= 8 )
+		{
+			result_ ^= round( 0, read64( pos_ ) );
+			result_ = rotateLeft( result_, 27 ) * PRIME_1 + PRIME_4;
+			pos_ += 8;
+		}
+
+		// Tail: 4 bytes.
+		if ( end_ - pos_ >= 4 )
+		{
+			result_ ^= read32( pos_ ) * PRIME_1;
+			result_ = rotateLeft( result_, 23 ) * PRIME_2 + PRIME_3;
+			pos_ += 4;
+		}
+
+		// Tail: single bytes.
+		while( pos_ < end_ )
+		{
+			result_ ^= static_cast<quint64>( *pos_ ) * PRIME_5;
+			result_ = rotateLeft( result_, 11 ) * PRIME_1;
+			pos_++;
+		}
+
+		// Avalanche
+		result_ ^= result_ >> 33;
+		result_ *= PRIME_2;
+		result_ ^= result_ >> 29;
+		result_ *= PRIME_3;
+		result_ ^= result_ >> 32;
+
+		// Return hash.
+		return( result_ );
+
+	} /// XXHash64::hash
+
+	// -----------------------------------------------------------
+
+} // rss
+
+// -----------------------------------------------------------
@@ -0,0 +1,119 @@
+/**
+* Copyright © Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef QRSS_READER_XXHASH64_HPP
+#define QRSS_READER_XXHASH64_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include qglobal (quint64)
+#ifndef QGLOBAL_H
+#include <qglobal.h>
+#endif // !QGLOBAL_H
+
+// Include C++ size_t.
+#include <cstddef>
+
+// ===========================================================
+// rss::XXHash64
+// ===========================================================
+
+namespace rss
+{
+
+	// -----------------------------------------------------------
+
+	/**
+	  * XXHash64 - xxHash64 (XXH64) of bytes.
+	  *
+	  * @brief
+	  * Non-cryptographic hash, reads 32 bytes per step (4 independent lanes),
+	  * so fingerprint of whole RSS-file costs about as much as reading it.
+	  * Result equals reference XXH64 implementation (little-endian input).
+	  *
+	  * @version 1.0
+	  * @since 17.10.2026
+	  * @authors Denis Z. (code4un@yandex.ru)
+	**/
+	class XXHash64 final
+	{
+
+	private:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// DELETED CONSTRUCTORS & OPERATORS
+		// ===========================================================
+
+		/** @deleted XXHash64 default constructor. **/
+		XXHash64( ) noexcept = delete;
+
+		/** @deleted XXHash64 const copy constructor. **/
+		XXHash64( const XXHash64 & ) noexcept = delete;
+
+		/** @deleted XXHash64 copy-assignment operator. **/
+		XXHash64 & operator=( const XXHash64 & ) noexcept = delete;
+
+		/** @deleted XXHash64 move constructor. **/
+		XXHash64( XXHash64 && ) noexcept = delete;
+
+		/** @deleted XXHash64 move assignment operator. **/
+		XXHash64 & operator=( XXHash64 && ) noexcept = delete;
+
+		// -----------------------------------------------------------
+
+	public:
+
+		// -----------------------------------------------------------
+
+		// ===========================================================
+		// METHODS
+		// ===========================================================
+
+		/**
+		  * Computes hash of bytes.
+		  *
+		  * @threadsafe - thread-safe.
+		  * @param pData - bytes.
+		  * @param pSize - number of bytes.
+		  * @param pSeed - seed.
+		  * @return - 64-bit hash.
+		  * @throws - no exceptions.
+		**/
+		static quint64 hash( const void *const pData, const size_t pSize, const quint64 pSeed = 0 ) noexcept;
+
+		// -----------------------------------------------------------
+
+	}; // rss::XXHash64
+
+	// -----------------------------------------------------------
+
+} // rss
+
+#define QRSS_READER_XXHASH64_DECL
+
+// -----------------------------------------------------------
+
+#endif // !QRSS_READER_XXHASH64_HPP